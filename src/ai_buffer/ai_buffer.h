@@ -99,6 +99,12 @@ typedef enum {
     DECISION_RETRY                   /* Retry with modifications */
 } ai_decision_t;
 
+/* Scatter-gather element */
+typedef struct {
+    uint8_t *data;
+    uint32_t length;
+} comm_sg_entry_t;
+
 /* Communication request structure */
 typedef struct {
     request_type_t type;
@@ -109,6 +115,8 @@ typedef struct {
     uint32_t flags;
     uint64_t timestamp;
     uint32_t priority;
+    const comm_sg_entry_t *sg;      /* Used instead of data when sg_count > 0 */
+    uint32_t sg_count;
 } comm_request_t;
 
 /* AI model state */
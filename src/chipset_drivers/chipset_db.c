@@ -0,0 +1,400 @@
+/*
+ * ParrotWinKernel - Chipset ID Database
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset ID Database Implementation
+ * 
+ * File layout: header, entries sorted by (vendor << 16 | device), then a
+ * string table. Vendor names are stored once and shared by their devices.
+ */
+
+#include "chipset_db.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define CHIPSET_DB_MAGIC        "PWKIDDB1"
+#define CHIPSET_DB_VERSION      1
+
+/* On-disk header */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+    uint32_t strings_size;
+    uint32_t reserved;
+} db_header_t;
+
+/* On-disk entry */
+typedef struct {
+    uint32_t key;               /* vendor << 16 | device */
+    uint32_t name;              /* String table offsets */
+    uint32_t vendor;
+    uint32_t type;              /* chipset_type_t */
+} db_entry_t;
+
+/* Loaded database */
+static struct {
+    pthread_rwlock_t lock;
+    void *map;
+    size_t map_size;
+    const db_entry_t *entries;
+    const char *strings;
+    uint32_t count;
+    uint32_t strings_size;
+} g_db = {
+    .lock = PTHREAD_RWLOCK_INITIALIZER
+};
+
+/* Helper: chipset family of a PCI vendor */
+static chipset_type_t vendor_type(uint32_t vendor_id) {
+    switch (vendor_id) {
+        case 0x8086:
+            return CHIPSET_INTEL;
+        case 0x1022:
+        case 0x1002:
+            return CHIPSET_AMD;
+        case 0x10DE:
+            return CHIPSET_NVIDIA;
+        case 0x17CB:
+        case 0x5143:
+            return CHIPSET_QUALCOMM;
+        default:
+            return CHIPSET_UNKNOWN;
+    }
+}
+
+/* Helper: append a string to the table */
+static int64_t add_string(char **strings, uint32_t *size, uint32_t *capacity, const char *s) {
+    size_t len = strlen(s) + 1;
+    while (*size + len > *capacity) {
+        uint32_t grown_capacity = *capacity ? *capacity * 2 : 4096;
+        char *grown = (char*)realloc(*strings, grown_capacity);
+        if (!grown) {
+            return -1;
+        }
+        *strings = grown;
+        *capacity = grown_capacity;
+    }
+    memcpy(*strings + *size, s, len);
+    *size += (uint32_t)len;
+    return *size - (int64_t)len;
+}
+
+/* Helper: order entries by key */
+static int compare_entries(const void *a, const void *b) {
+    uint32_t ka = ((const db_entry_t*)a)->key;
+    uint32_t kb = ((const db_entry_t*)b)->key;
+    return ka < kb ? -1 : ka > kb;
+}
+
+/* Helper: parse "<hex4>  <name>" */
+static bool parse_id_line(char *line, uint32_t *id, char **name) {
+    for (int i = 0; i < 4; i++) {
+        if (!isxdigit((unsigned char)line[i])) {
+            return false;
+        }
+    }
+    if (line[4] != ' ') {
+        return false;
+    }
+    *id = (uint32_t)strtoul(line, NULL, 16);
+    *name = line + 4;
+    while (**name == ' ') {
+        (*name)++;
+    }
+    (*name)[strcspn(*name, "\r\n")] = '\0';
+    return true;
+}
+
+/* Compile database */
+int chipset_db_compile(const char *ids_path, const char *db_path) {
+    if (!ids_path || !db_path) {
+        return -1;
+    }
+    
+    FILE *in = fopen(ids_path, "r");
+    if (!in) {
+        fprintf(stderr, "[CHIPSET] Cannot open ID list: %s\n", ids_path);
+        return -1;
+    }
+    
+    db_entry_t *entries = NULL;
+    uint32_t count = 0;
+    uint32_t capacity = 0;
+    char *strings = NULL;
+    uint32_t strings_size = 0;
+    uint32_t strings_capacity = 0;
+    
+    uint32_t vendor_id = 0;
+    int64_t vendor_name = -1;
+    bool failed = false;
+    char line[512];
+    
+    while (!failed && fgets(line, sizeof(line), in)) {
+        uint32_t id;
+        char *name;
+        
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        
+        /* The class section ends the vendor/device list */
+        if (line[0] == 'C' && line[1] == ' ') {
+            break;
+        }
+        
+        if (line[0] != '\t') {
+            if (parse_id_line(line, &id, &name)) {
+                vendor_id = id;
+                vendor_name = add_string(&strings, &strings_size, &strings_capacity, name);
+                failed = vendor_name < 0;
+            } else {
+                vendor_name = -1;
+            }
+            continue;
+        }
+        
+        /* Devices have one tab; subsystems have two */
+        if (line[1] == '\t' || vendor_name < 0 || !parse_id_line(line + 1, &id, &name)) {
+            continue;
+        }
+        
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 1024;
+            db_entry_t *grown = (db_entry_t*)realloc(entries, capacity * sizeof(db_entry_t));
+            if (!grown) {
+                failed = true;
+                break;
+            }
+            entries = grown;
+        }
+        
+        int64_t device_name = add_string(&strings, &strings_size, &strings_capacity, name);
+        if (device_name < 0) {
+            failed = true;
+            break;
+        }
+        
+        entries[count].key = (vendor_id << 16) | (id & 0xFFFF);
+        entries[count].name = (uint32_t)device_name;
+        entries[count].vendor = (uint32_t)vendor_name;
+        entries[count].type = vendor_type(vendor_id);
+        count++;
+    }
+    fclose(in);
+    
+    if (failed) {
+        free(entries);
+        free(strings);
+        return -1;
+    }
+    
+    /* Sort and keep the first of any duplicate IDs */
+    qsort(entries, count, sizeof(db_entry_t), compare_entries);
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (unique == 0 || entries[unique - 1].key != entries[i].key) {
+            entries[unique++] = entries[i];
+        }
+    }
+    
+    db_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CHIPSET_DB_MAGIC, sizeof(header.magic));
+    header.version = CHIPSET_DB_VERSION;
+    header.count = unique;
+    header.strings_size = strings_size;
+    
+    char tmp[512];
+    snprintf(tmp, sizeof(tmp), "%s.%d", db_path, (int)getpid());
+    FILE *out = fopen(tmp, "wb");
+    bool ok = out &&
+              fwrite(&header, sizeof(header), 1, out) == 1 &&
+              fwrite(entries, sizeof(db_entry_t), unique, out) == unique &&
+              fwrite(strings, 1, strings_size, out) == strings_size;
+    if (out && fclose(out) != 0) {
+        ok = false;
+    }
+    
+    free(entries);
+    free(strings);
+    
+    if (!ok || rename(tmp, db_path) != 0) {
+        unlink(tmp);
+        fprintf(stderr, "[CHIPSET] Cannot write ID database: %s\n", db_path);
+        return -1;
+    }
+    
+    printf("[CHIPSET] Compiled %u device IDs into %s\n", unique, db_path);
+    
+    return (int)unique;
+}
+
+/* Load database */
+int chipset_db_load(const char *db_path) {
+    if (!db_path) {
+        return -1;
+    }
+    
+    int fd = open(db_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(db_header_t)) {
+        close(fd);
+        return -1;
+    }
+    
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return -1;
+    }
+    
+    /* Validate before publishing */
+    const db_header_t *header = (const db_header_t*)map;
+    uint64_t expected = sizeof(db_header_t) + (uint64_t)header->count * sizeof(db_entry_t) +
+                        header->strings_size;
+    const db_entry_t *entries = (const db_entry_t*)(header + 1);
+    const char *strings = (const char*)(entries + header->count);
+    bool valid = memcmp(header->magic, CHIPSET_DB_MAGIC, sizeof(header->magic)) == 0 &&
+                 header->version == CHIPSET_DB_VERSION &&
+                 expected == (uint64_t)st.st_size &&
+                 (header->strings_size == 0 || strings[header->strings_size - 1] == '\0');
+    for (uint32_t i = 0; valid && i < header->count; i++) {
+        valid = entries[i].name < header->strings_size &&
+                entries[i].vendor < header->strings_size &&
+                (i == 0 || entries[i - 1].key < entries[i].key);
+    }
+    
+    if (!valid) {
+        fprintf(stderr, "[CHIPSET] Invalid ID database: %s\n", db_path);
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+    
+    pthread_rwlock_wrlock(&g_db.lock);
+    void *old_map = g_db.map;
+    size_t old_size = g_db.map_size;
+    g_db.map = map;
+    g_db.map_size = (size_t)st.st_size;
+    g_db.entries = entries;
+    g_db.strings = strings;
+    g_db.count = header->count;
+    g_db.strings_size = header->strings_size;
+    pthread_rwlock_unlock(&g_db.lock);
+    
+    if (old_map) {
+        munmap(old_map, old_size);
+    }
+    
+    printf("[CHIPSET] Loaded ID database with %u devices\n", header->count);
+    
+    return 0;
+}
+
+/* Unload database */
+void chipset_db_unload(void) {
+    pthread_rwlock_wrlock(&g_db.lock);
+    if (g_db.map) {
+        munmap(g_db.map, g_db.map_size);
+    }
+    g_db.map = NULL;
+    g_db.map_size = 0;
+    g_db.entries = NULL;
+    g_db.strings = NULL;
+    g_db.count = 0;
+    g_db.strings_size = 0;
+    pthread_rwlock_unlock(&g_db.lock);
+}
+
+/* Lookup device */
+bool chipset_db_lookup(uint32_t vendor_id, uint32_t device_id, chipset_db_entry_t *entry) {
+    uint32_t key = (vendor_id << 16) | (device_id & 0xFFFF);
+    bool found = false;
+    
+    pthread_rwlock_rdlock(&g_db.lock);
+    uint32_t lo = 0;
+    uint32_t hi = g_db.count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        uint32_t k = g_db.entries[mid].key;
+        if (k == key) {
+            if (entry) {
+                snprintf(entry->name, sizeof(entry->name), "%s",
+                         g_db.strings + g_db.entries[mid].name);
+                snprintf(entry->vendor, sizeof(entry->vendor), "%s",
+                         g_db.strings + g_db.entries[mid].vendor);
+                entry->type = (chipset_type_t)g_db.entries[mid].type;
+            }
+            found = true;
+            break;
+        }
+        if (k < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    pthread_rwlock_unlock(&g_db.lock);
+    
+    return found;
+}
+
+/* Database size */
+uint32_t chipset_db_count(void) {
+    pthread_rwlock_rdlock(&g_db.lock);
+    uint32_t count = g_db.count;
+    pthread_rwlock_unlock(&g_db.lock);
+    return count;
+}
@@ -0,0 +1,112 @@
+/*
+ * ParrotWinKernel - Chipset ID Database
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset ID Database
+ * 
+ * Vendor/device names compiled from a pci.ids-style text file into a
+ * sorted binary table, mmapped read-only and searched by binary search.
+ */
+
+#ifndef CHIPSET_DB_H
+#define CHIPSET_DB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../kernel_bridge/kernel_bridge.h"
+
+#define CHIPSET_DB_DEFAULT      "/opt/windrvmgr/chipset_ids.db"
+
+/* Lookup result (copied out of the mapping) */
+typedef struct {
+    char name[64];
+    char vendor[64];
+    chipset_type_t type;
+} chipset_db_entry_t;
+
+/* API Functions */
+
+/**
+ * chipset_db_compile - Compile a pci.ids-style text file
+ * @ids_path: Text file with vendor lines and tab-indented device lines
+ * @db_path: Output binary database (written atomically)
+ * 
+ * Subsystem lines and the class section are ignored. The chipset type is
+ * derived from the vendor ID.
+ * 
+ * Returns: Number of devices compiled, negative on error
+ */
+int chipset_db_compile(const char *ids_path, const char *db_path);
+
+/**
+ * chipset_db_load - Map a compiled database, replacing any loaded one
+ * @db_path: Binary database from chipset_db_compile()
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_db_load(const char *db_path);
+
+/**
+ * chipset_db_unload - Unmap the loaded database
+ */
+void chipset_db_unload(void);
+
+/**
+ * chipset_db_lookup - Find a device in the loaded database
+ * @vendor_id: PCI vendor ID
+ * @device_id: PCI device ID
+ * @entry: Output names and type
+ * 
+ * Returns: true if found, false if not found or no database is loaded
+ */
+bool chipset_db_lookup(uint32_t vendor_id, uint32_t device_id, chipset_db_entry_t *entry);
+
+/**
+ * chipset_db_count - Number of devices in the loaded database
+ * 
+ * Returns: Device count, 0 if no database is loaded
+ */
+uint32_t chipset_db_count(void);
+
+#endif /* CHIPSET_DB_H */
@@ -50,19 +50,384 @@
  */
 
 #include "chipset_driver.h"
+#include "pci_topology.h"
+#include "chipset_db.h"
+#include "chipset_ops.h"
+#include "chipset_image.h"
+#include "chipset_repo.h"
+#include "chipset_profile.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <dirent.h>
 #include <sys/stat.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+
+/* Shadow register range */
+typedef struct {
+    uint32_t start;
+    uint32_t end;               /* Exclusive */
+    chipset_cache_policy_t policy;
+    uint32_t *values;
+    uint32_t *staging;          /* Payloads of the flush in flight */
+    uint64_t *valid;            /* One bit per register */
+    uint64_t *dirty;
+} shadow_range_t;
+
+/* Per-driver state behind driver->driver_handle */
+typedef struct chipset_instance {
+    /* Direct register window (mmapped BAR or stand-in file) */
+    volatile uint8_t *mmio;
+    size_t mmio_size;
+    struct {
+        uint32_t start;
+        uint32_t end;           /* Exclusive */
+    } direct[CHIPSET_MAX_DIRECT_RANGES];
+    uint32_t direct_count;
+    
+    /* Shadow register file; ranges are only added, count published last */
+    pthread_mutex_t shadow_lock;
+    shadow_range_t shadow[CHIPSET_MAX_SHADOW_RANGES];
+    uint32_t shadow_count;
+    chipset_shadow_stats_t shadow_stats;
+    
+    /* Flushes are serialized; taken before shadow_lock */
+    pthread_mutex_t flush_lock;
+    bridge_future_t *flush_future;
+    bool flush_inflight;        /* Previous flush timed out */
+    
+    /* Posted writes: submissions and their completions (by workers) */
+    uint64_t posted_issued;
+    uint64_t posted_done;
+    int32_t posted_error;       /* First failure since the last barrier */
+    uint32_t posted_waiters;
+    pthread_mutex_t posted_lock;
+    pthread_cond_t posted_cond;
+    
+    /* Bound once at load, every hook resolved */
+    chipset_ops_t ops;
+    uint32_t power_state;       /* Current D-state, changed under pm_lock */
+    
+    /* Runtime PM; transitions under pm_lock, usage and activity lock-free */
+    pthread_mutex_t pm_lock;
+    pthread_cond_t pm_cond;
+    uint32_t pm_state;          /* PM_ACTIVE, ... */
+    uint32_t pm_usage;          /* Requests holding the device awake */
+    uint64_t pm_last_active_ns;
+    bool pm_enabled;
+    bool pm_auto_suspended;     /* Suspended by runtime PM, not by a caller */
+    uint32_t pm_delay_ms;       /* As configured */
+    uint32_t pm_effective_ms;   /* After thrash backoff */
+    uint32_t pm_suspend_state;
+    uint64_t pm_state_since_ns;
+    uint64_t pm_time_ns[4];     /* Per D-state, up to pm_state_since_ns */
+    chipset_pm_stats_t pm_stats;
+    
+    /* Discovered once at load */
+    pci_caps_t pci;
+    bool pci_valid;
+    driver_capabilities_t caps;
+    uint32_t write_run_max;     /* Registers per coalesced write, one max payload */
+    
+    /* Driver image, shared with every device loading the same file */
+    chipset_image_t *image;
+    
+    /* Register access profile; allocated on first enable, kept until unload */
+    chipset_profile_t *profile;
+    bool profiling;
+    
+    /* Canonical record; caller structs only carry its handle */
+    chipset_driver_t record;
+    uint32_t slot;
+    uint32_t hash;
+    bool unloading;
+    struct chipset_instance *hash_next;
+} chipset_instance_t;
+
+#define CHIPSET_SLOT_CHUNK      64      /* Slots per table chunk */
+#define CHIPSET_MAX_CHUNKS      1024    /* Up to 65536 loaded drivers */
+#define CHIPSET_HASH_INITIAL    64
+
+/* Handles pack the slot index below a generation; stale handles miss */
+#define HANDLE_SLOT_BITS        16
+#define HANDLE_GEN_MASK         (UINTPTR_MAX >> HANDLE_SLOT_BITS)
+
+/* Loaded-driver slot; chunks never move, so lookups take no lock */
+typedef struct {
+    chipset_instance_t *inst;   /* NULL when free */
+    uintptr_t generation;
+    uint32_t next_free;         /* Slot index + 1, 0 at the end of the list */
+    uint32_t users;             /* Calls pinning the instance */
+    bool closing;               /* Unload waits for users; new calls fail */
+} driver_slot_t;
 
 /* Global chipset state */
 static struct {
     bool initialized;
-    chipset_driver_t loaded_drivers[32];
+    
+    /* Loaded drivers, indexed by handle */
+    pthread_mutex_t lock;
+    driver_slot_t *chunks[CHIPSET_MAX_CHUNKS];
+    uint32_t chunk_count;
+    uint32_t free_head;         /* Slot index + 1, 0 if none */
     uint32_t driver_count;
+    
+    /* By (vendor_id, device_id, pci_address), chained through instances */
+    chipset_instance_t **buckets;
+    uint32_t bucket_count;      /* Power of two */
+    
+    /* Unloads wait here for a closing slot's users to leave */
+    pthread_cond_t drain_cond;
+    
+    /* Autosuspend thread, sleeps on pm_cond under lock */
+    pthread_t pm_thread;
+    bool pm_running;
+    pthread_cond_t pm_cond;
 } g_chipset = {0};
 
+#define CHIPSET_SUBMIT_BATCH    64  /* Requests per batched submission */
+#define CHIPSET_TRANSFER_WINDOW (1024 * 1024)  /* Staged bytes per transfer submission */
+
+/* Runtime PM states */
+#define PM_ACTIVE               0
+#define PM_SUSPENDING           1
+#define PM_SUSPENDED            2
+#define PM_RESUMING             3
+
+#define PM_DEFAULT_DELAY_MS     2000
+#define PM_MAX_BACKOFF          16      /* Effective delay ceiling, in configured delays */
+#define PM_POLL_MAX_MS          1000
+
+#define BIT_WORD(i)             ((i) / 64)
+#define BIT_MASK(i)             (1ULL << ((i) % 64))
+
+/* Per-thread future for synchronous reads */
+static pthread_key_t g_future_key;
+static pthread_once_t g_future_once = PTHREAD_ONCE_INIT;
+
+/* Helper: slot for an index, NULL past the allocated chunks */
+static inline driver_slot_t* slot_at(uint32_t index) {
+    uint32_t chunk = index / CHIPSET_SLOT_CHUNK;
+    if (chunk >= __atomic_load_n(&g_chipset.chunk_count, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    return &g_chipset.chunks[chunk][index % CHIPSET_SLOT_CHUNK];
+}
+
+/* Helper: internal state of a loaded driver, NULL if unloaded or stale */
+static inline chipset_instance_t* instance_of(const chipset_driver_t *driver) {
+    uintptr_t handle = (uintptr_t)driver->driver_handle;
+    if (handle == 0) {
+        return NULL;
+    }
+    
+    driver_slot_t *slot = slot_at((uint32_t)(handle & ((1u << HANDLE_SLOT_BITS) - 1)));
+    if (!slot) {
+        return NULL;
+    }
+    chipset_instance_t *inst = __atomic_load_n(&slot->inst, __ATOMIC_ACQUIRE);
+    if (!inst || __atomic_load_n(&slot->generation, __ATOMIC_RELAXED) !=
+                 (handle >> HANDLE_SLOT_BITS)) {
+        return NULL;
+    }
+    return inst;
+}
+
+/* Helper: slot holding a table instance */
+static inline driver_slot_t* slot_of(const chipset_instance_t *inst) {
+    return &g_chipset.chunks[inst->slot / CHIPSET_SLOT_CHUNK][inst->slot % CHIPSET_SLOT_CHUNK];
+}
+
+/* Instance being unloaded by this thread; its teardown calls pass the
+ * closed slot */
+static __thread chipset_instance_t *tls_unloading;
+
+/* Helper: leave a slot, waking an unload waiting for it to drain */
+static void slot_leave(driver_slot_t *slot) {
+    if (__atomic_sub_fetch(&slot->users, 1, __ATOMIC_SEQ_CST) == 0 &&
+        __atomic_load_n(&slot->closing, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&g_chipset.lock);
+        pthread_cond_broadcast(&g_chipset.drain_cond);
+        pthread_mutex_unlock(&g_chipset.lock);
+    }
+}
+
+/* Helper: pin a loaded driver's instance for one call, NULL if unloaded,
+ * stale or being unloaded. The user count is raised before the lookup
+ * and unload closes the slot before checking it, so an instance is not
+ * freed while a call holds it. Must not be called with g_chipset.lock. */
+static chipset_instance_t* instance_get(const chipset_driver_t *driver) {
+    uintptr_t handle = (uintptr_t)driver->driver_handle;
+    driver_slot_t *slot = handle ? slot_at((uint32_t)(handle & ((1u << HANDLE_SLOT_BITS) - 1)))
+                                 : NULL;
+    if (!slot) {
+        return NULL;
+    }
+    
+    __atomic_add_fetch(&slot->users, 1, __ATOMIC_SEQ_CST);
+    chipset_instance_t *inst = instance_of(driver);
+    if (inst && __atomic_load_n(&slot->closing, __ATOMIC_SEQ_CST) && tls_unloading != inst) {
+        inst = NULL;
+    }
+    if (!inst) {
+        slot_leave(slot);
+    }
+    return inst;
+}
+
+/* Helper: release a pin from instance_get() */
+static inline void instance_put(chipset_instance_t *inst) {
+    slot_leave(slot_of(inst));
+}
+
+/* Helper: hash of the driver key */
+static uint32_t driver_key_hash(uint32_t vendor_id, uint32_t device_id, const char *address) {
+    uint32_t hash = 2166136261u;
+    uint32_t ids[2] = {vendor_id, device_id};
+    const uint8_t *p = (const uint8_t*)ids;
+    for (size_t i = 0; i < sizeof(ids); i++) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    for (p = (const uint8_t*)address; *p; p++) {
+        hash = (hash ^ *p) * 16777619u;
+    }
+    return hash;
+}
+
+/* Helper: loaded instance by key (caller holds g_chipset.lock) */
+static chipset_instance_t* hash_find(uint32_t vendor_id, uint32_t device_id,
+                                     const char *address, uint32_t hash) {
+    if (g_chipset.bucket_count == 0) {
+        return NULL;
+    }
+    chipset_instance_t *inst = g_chipset.buckets[hash & (g_chipset.bucket_count - 1)];
+    for (; inst; inst = inst->hash_next) {
+        if (inst->hash == hash && inst->record.vendor_id == vendor_id &&
+            inst->record.device_id == device_id &&
+            strcmp(inst->record.pci_address, address) == 0) {
+            return inst;
+        }
+    }
+    return NULL;
+}
+
+/* Helper: add an instance to the table and hash (caller holds g_chipset.lock) */
+static int table_insert(chipset_instance_t *inst) {
+    /* Grow the hash at load factor 1 */
+    if (g_chipset.driver_count + 1 > g_chipset.bucket_count) {
+        uint32_t count = g_chipset.bucket_count ? g_chipset.bucket_count * 2 : CHIPSET_HASH_INITIAL;
+        chipset_instance_t **buckets = (chipset_instance_t**)calloc(count, sizeof(*buckets));
+        if (!buckets) {
+            return CHIPSET_ERR_NO_MEMORY;
+        }
+        for (uint32_t b = 0; b < g_chipset.bucket_count; b++) {
+            chipset_instance_t *next;
+            for (chipset_instance_t *it = g_chipset.buckets[b]; it; it = next) {
+                next = it->hash_next;
+                it->hash_next = buckets[it->hash & (count - 1)];
+                buckets[it->hash & (count - 1)] = it;
+            }
+        }
+        free(g_chipset.buckets);
+        g_chipset.buckets = buckets;
+        g_chipset.bucket_count = count;
+    }
+    
+    /* Reuse a free slot, or add a chunk */
+    if (g_chipset.free_head == 0) {
+        if (g_chipset.chunk_count == CHIPSET_MAX_CHUNKS) {
+            return CHIPSET_ERR_NO_MEMORY;
+        }
+        driver_slot_t *chunk = (driver_slot_t*)calloc(CHIPSET_SLOT_CHUNK, sizeof(driver_slot_t));
+        if (!chunk) {
+            return CHIPSET_ERR_NO_MEMORY;
+        }
+        uint32_t base = g_chipset.chunk_count * CHIPSET_SLOT_CHUNK;
+        for (uint32_t i = 0; i < CHIPSET_SLOT_CHUNK; i++) {
+            chunk[i].generation = 1;
+            chunk[i].next_free = (i + 1 < CHIPSET_SLOT_CHUNK) ? base + i + 2 : 0;
+        }
+        g_chipset.chunks[g_chipset.chunk_count] = chunk;
+        __atomic_store_n(&g_chipset.chunk_count, g_chipset.chunk_count + 1, __ATOMIC_RELEASE);
+        g_chipset.free_head = base + 1;
+    }
+    
+    inst->slot = g_chipset.free_head - 1;
+    driver_slot_t *slot = slot_of(inst);
+    g_chipset.free_head = slot->next_free;
+    
+    inst->record.driver_handle = (void*)((slot->generation << HANDLE_SLOT_BITS) | inst->slot);
+    __atomic_store_n(&slot->inst, inst, __ATOMIC_RELEASE);
+    
+    uint32_t bucket = inst->hash & (g_chipset.bucket_count - 1);
+    inst->hash_next = g_chipset.buckets[bucket];
+    g_chipset.buckets[bucket] = inst;
+    g_chipset.driver_count++;
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Helper: drop an instance from the hash and refuse new calls on its
+ * slot (caller holds g_chipset.lock) */
+static void table_close(chipset_instance_t *inst) {
+    chipset_instance_t **link = &g_chipset.buckets[inst->hash & (g_chipset.bucket_count - 1)];
+    while (*link != inst) {
+        link = &(*link)->hash_next;
+    }
+    *link = inst->hash_next;
+    
+    __atomic_store_n(&slot_of(inst)->closing, true, __ATOMIC_SEQ_CST);
+}
+
+/* Helper: free a closed instance's slot (caller holds g_chipset.lock) */
+static void table_remove(chipset_instance_t *inst) {
+    /* New generation invalidates every outstanding handle */
+    driver_slot_t *slot = slot_of(inst);
+    __atomic_store_n(&slot->inst, NULL, __ATOMIC_RELEASE);
+    __atomic_store_n(&slot->closing, false, __ATOMIC_RELAXED);
+    uintptr_t generation = (slot->generation + 1) & HANDLE_GEN_MASK;
+    __atomic_store_n(&slot->generation, generation ? generation : 1, __ATOMIC_RELAXED);
+    slot->next_free = g_chipset.free_head;
+    g_chipset.free_head = inst->slot + 1;
+    g_chipset.driver_count--;
+}
+
+/* Helper: register reachable through the mmapped window */
+static inline bool direct_access(const chipset_instance_t *inst, uint32_t offset) {
+    if (!inst || !inst->mmio || (offset & 3) != 0) {
+        return false;
+    }
+    for (uint32_t i = 0; i < inst->direct_count; i++) {
+        if (offset >= inst->direct[i].start && offset < inst->direct[i].end) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Helper: shadow range holding a register, NULL if uncached */
+static inline shadow_range_t* shadow_lookup(chipset_instance_t *inst, uint32_t offset,
+                                            uint32_t *index) {
+    uint32_t count = inst ? __atomic_load_n(&inst->shadow_count, __ATOMIC_ACQUIRE) : 0;
+    if (count == 0 || (offset & 3) != 0) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        shadow_range_t *range = &inst->shadow[i];
+        if (offset >= range->start && offset < range->end) {
+            if (range->policy == CHIPSET_CACHE_VOLATILE) {
+                return NULL;
+            }
+            *index = (offset - range->start) / 4;
+            return range;
+        }
+    }
+    return NULL;
+}
+
 /* Known chipsets database */
 static const struct {
     uint32_t vendor_id;
@@ -90,6 +455,25 @@ static const struct {
     {0, 0, CHIPSET_UNKNOWN, NULL, NULL}
 };
 
+/* Helper: identify a chipset from the ID database or built-in table */
+static bool lookup_chipset(uint32_t vendor_id, uint32_t device_id, chipset_db_entry_t *entry) {
+    if (chipset_db_lookup(vendor_id, device_id, entry)) {
+        return true;
+    }
+    
+    for (int i = 0; known_chipsets[i].name != NULL; i++) {
+        if (known_chipsets[i].vendor_id == vendor_id &&
+            known_chipsets[i].device_id == device_id) {
+            snprintf(entry->name, sizeof(entry->name), "%s", known_chipsets[i].name);
+            snprintf(entry->vendor, sizeof(entry->vendor), "%s", known_chipsets[i].vendor);
+            entry->type = known_chipsets[i].type;
+            return true;
+        }
+    }
+    
+    return false;
+}
+
 /* Initialize chipset subsystem */
 int chipset_init(void) {
     if (g_chipset.initialized) {
@@ -97,8 +481,25 @@ int chipset_init(void) {
     }
     
     memset(&g_chipset, 0, sizeof(g_chipset));
+    pthread_mutex_init(&g_chipset.lock, NULL);
+    
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&g_chipset.pm_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_cond_init(&g_chipset.drain_cond, NULL);
+    
     g_chipset.initialized = true;
     
+    /* Optional large ID database; the built-in table covers the rest */
+    if (chipset_db_count() == 0) {
+        chipset_db_load(CHIPSET_DB_DEFAULT);
+    }
+    
+    /* Driver lookups become index searches instead of file probes */
+    chipset_repo_open(CHIPSET_REPO_DIR_DEFAULT, CHIPSET_REPO_INDEX_DEFAULT, true);
+    
     printf("[CHIPSET] Initialized chipset driver subsystem\n");
     
     return CHIPSET_SUCCESS;
@@ -110,17 +511,105 @@ void chipset_shutdown(void) {
         return;
     }
     
-    /* Unload all drivers */
-    for (uint32_t i = 0; i < g_chipset.driver_count; i++) {
-        if (g_chipset.loaded_drivers[i].loaded) {
-            chipset_unload_driver(&g_chipset.loaded_drivers[i]);
+    /* Stop autosuspend before the devices go away */
+    pthread_mutex_lock(&g_chipset.lock);
+    bool pm_started = g_chipset.pm_running;
+    g_chipset.pm_running = false;
+    pthread_cond_signal(&g_chipset.pm_cond);
+    pthread_mutex_unlock(&g_chipset.lock);
+    if (pm_started) {
+        pthread_join(g_chipset.pm_thread, NULL);
+    }
+    
+    /* Unload all drivers through their canonical records */
+    uint32_t slots = g_chipset.chunk_count * CHIPSET_SLOT_CHUNK;
+    for (uint32_t i = 0; i < slots; i++) {
+        chipset_instance_t *inst = __atomic_load_n(&slot_at(i)->inst, __ATOMIC_ACQUIRE);
+        if (inst) {
+            chipset_unload_driver(&inst->record);
         }
     }
     
-    g_chipset.initialized = false;
+    chipset_repo_close();
+    
+    for (uint32_t c = 0; c < g_chipset.chunk_count; c++) {
+        free(g_chipset.chunks[c]);
+    }
+    free(g_chipset.buckets);
+    pthread_mutex_destroy(&g_chipset.lock);
+    pthread_cond_destroy(&g_chipset.pm_cond);
+    pthread_cond_destroy(&g_chipset.drain_cond);
+    memset(&g_chipset, 0, sizeof(g_chipset));
     printf("[CHIPSET] Shutdown complete\n");
 }
 
+/* Helper: fill a record; @fn is the enumerated function from @topology, or NULL */
+static int identify(uint32_t vendor_id, uint32_t device_id, const char *pci_address,
+                    const pci_topology_t *topology, const pci_function_t *fn,
+                    chipset_driver_t *driver) {
+    chipset_db_entry_t known;
+    if (!lookup_chipset(vendor_id, device_id, &known)) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    memset(driver, 0, sizeof(*driver));
+    memcpy(driver->name, known.name, sizeof(driver->name));
+    memcpy(driver->vendor, known.vendor, sizeof(driver->vendor));
+    driver->vendor_id = vendor_id;
+    driver->device_id = device_id;
+    driver->chipset_type = known.type;
+    driver->loaded = false;
+    driver->driver_handle = NULL;
+    driver->bridge_context = NULL;
+    driver->numa_node = -1;
+    if (pci_address) {
+        snprintf(driver->pci_address, sizeof(driver->pci_address), "%s", pci_address);
+    }
+    
+    /* Subsystem and class refine the match when the function is enumerated */
+    uint32_t subsys_vendor_id = CHIPSET_REPO_ANY;
+    uint32_t subsys_device_id = CHIPSET_REPO_ANY;
+    uint32_t class_code = CHIPSET_REPO_ANY;
+    if (fn) {
+        subsys_vendor_id = fn->subsys_vendor_id;
+        subsys_device_id = fn->subsys_device_id;
+        class_code = fn->class_code;
+        
+        /* Where the device sits, for placing its bridge work */
+        driver->numa_node = fn->numa_node;
+        memcpy(driver->local_cpulist, fn->local_cpulist, sizeof(driver->local_cpulist));
+        const pci_function_t *port = pci_topology_root_port(topology, fn->address);
+        if (port) {
+            memcpy(driver->root_port, port->address, sizeof(driver->root_port));
+        }
+    }
+    
+    /* An open index decides, empty if no rule matches; without one, the conventional name */
+    if (chipset_repo_match(vendor_id, device_id, subsys_vendor_id, subsys_device_id, class_code,
+                           driver->driver_path, sizeof(driver->driver_path)) < 0) {
+        snprintf(driver->driver_path, sizeof(driver->driver_path),
+                "%s/%04x_%04x.sys", CHIPSET_REPO_DIR_DEFAULT,
+                vendor_id, device_id);
+    }
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Identify chipset */
+int chipset_identify(uint32_t vendor_id, uint32_t device_id, const char *pci_address,
+                     chipset_driver_t *driver) {
+    if (!driver) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    const pci_topology_t *topology = pci_address ? pci_topology_get() : NULL;
+    const pci_function_t *fn = topology ? pci_topology_find(topology, pci_address) : NULL;
+    int result = identify(vendor_id, device_id, pci_address, topology, fn, driver);
+    pci_topology_put(topology);
+    
+    return result;
+}
+
 /* Detect chipsets */
 int chipset_detect(chipset_driver_t *drivers, uint32_t max_drivers, uint32_t *count) {
     if (!g_chipset.initialized || !drivers || !count) {
@@ -131,74 +620,365 @@ int chipset_detect(chipset_driver_t *drivers, uint32_t max_drivers, uint32_t *co
     
     printf("[CHIPSET] Scanning for chipsets...\n");
     
-    /* Scan PCI devices */
-    DIR *dir = opendir("/sys/bus/pci/devices");
-    if (!dir) {
-        fprintf(stderr, "[CHIPSET] Cannot access PCI devices\n");
+    /* Enumerated once and cached; see pci_topology_rescan() */
+    const pci_topology_t *topology = pci_topology_get();
+    if (!topology) {
         return CHIPSET_ERR_IO_ERROR;
     }
     
-    struct dirent *entry;
-    while ((entry = readdir(dir)) != NULL && *count < max_drivers) {
-        if (entry->d_name[0] == '.') continue;
-        
-        /* Read vendor and device ID */
-        char path[512];
-        FILE *f;
-        uint32_t vendor_id, device_id;
+    for (uint32_t f = 0; f < topology->count && *count < max_drivers; f++) {
+        const pci_function_t *fn = &topology->functions[f];
         
-        snprintf(path, sizeof(path), "/sys/bus/pci/devices/%s/vendor", entry->d_name);
-        f = fopen(path, "r");
-        if (f) {
-            fscanf(f, "%x", &vendor_id);
-            fclose(f);
-        } else {
+        /* Check if it's a known chipset */
+        chipset_driver_t *drv = &drivers[*count];
+        if (identify(fn->vendor_id, fn->device_id, fn->address, topology, fn, drv) != CHIPSET_SUCCESS) {
             continue;
         }
         
-        snprintf(path, sizeof(path), "/sys/bus/pci/devices/%s/device", entry->d_name);
-        f = fopen(path, "r");
-        if (f) {
-            fscanf(f, "%x", &device_id);
-            fclose(f);
-        } else {
+        printf("[CHIPSET] Found: %s (VID:0x%04x DID:0x%04x)\n",
+               drv->name, fn->vendor_id, fn->device_id);
+        
+        (*count)++;
+    }
+    
+    pci_topology_put(topology);
+    
+    printf("[CHIPSET] Detected %u chipsets\n", *count);
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Helper: bind the most specific operations table */
+static void bind_ops(chipset_instance_t *inst) {
+    const chipset_driver_t *driver = &inst->record;
+    inst->ops = *chipset_ops_lookup(driver->vendor_id, driver->device_id, driver->chipset_type);
+    
+    /* Hot paths call through without checking */
+    if (!inst->ops.read_register) {
+        inst->ops.read_register = chipset_generic_ops.read_register;
+    }
+    if (!inst->ops.write_register) {
+        inst->ops.write_register = chipset_generic_ops.write_register;
+    }
+    if (!inst->ops.set_power) {
+        inst->ops.set_power = chipset_generic_ops.set_power;
+    }
+    if (inst->ops.batch_size == 0 || inst->ops.batch_size > CHIPSET_SUBMIT_BATCH) {
+        inst->ops.batch_size = CHIPSET_SUBMIT_BATCH;
+    }
+    if (!inst->ops.name) {
+        inst->ops.name = "custom";
+    }
+    
+    printf("[CHIPSET] %s bound to %s operations\n", driver->name, inst->ops.name);
+}
+
+/* Helper: whether a device class does DMA: 1 yes, 0 no, -1 if the class
+ * does not say. Bus Master enable only tells whether DMA is switched on. */
+static int class_dma_capable(uint32_t class_code) {
+    uint32_t base = class_code >> 16;
+    uint32_t sub = (class_code >> 8) & 0xFF;
+    
+    switch (base) {
+    case 0x01:      /* Mass storage */
+    case 0x02:      /* Network */
+    case 0x03:      /* Display */
+    case 0x04:      /* Multimedia */
+    case 0x0C:      /* Serial bus (USB, FireWire, ...) */
+    case 0x0D:      /* Wireless */
+    case 0x10:      /* Encryption */
+    case 0x12:      /* Processing accelerator */
+        return 1;
+    case 0x05:      /* Memory controller */
+    case 0x06:      /* Bridge */
+        return 0;
+    case 0x08:      /* System peripheral; only the DMA controller moves data */
+        return sub == 0x01;
+    default:
+        return -1;
+    }
+}
+
+/* Helper: probe config space and derive the driver's capabilities */
+static void discover_capabilities(chipset_instance_t *inst) {
+    const chipset_driver_t *driver = &inst->record;
+    driver_capabilities_t *caps = &inst->caps;
+    
+    *caps = inst->ops.caps;
+    
+    if (driver->pci_address[0] == '\0' || pci_caps_read(driver->pci_address, &inst->pci) != 0) {
+        if (inst->ops.apply_errata) {
+            inst->ops.apply_errata(driver, caps);
+        }
+        return;
+    }
+    inst->pci_valid = true;
+    const pci_caps_t *pci = &inst->pci;
+    
+    int dma = class_dma_capable(pci->class_code);
+    if (dma >= 0) {
+        caps->supports_dma = dma != 0;
+    }
+    
+    /* Without the capability list these keep the type defaults */
+    if (pci->valid) {
+        caps->supports_msi = pci->msi || pci->msix;
+        caps->supports_power_management = pci->pm;
+        caps->supports_pcie = pci->pcie;
+    }
+    
+    /* Posted write runs stop at one payload. Alignment and transfer size
+     * keep the type's values: max payload only sizes TLPs, and a BAR is
+     * a register window, not a bound on what a transfer may move. */
+    if (pci->pcie && pci->max_payload > 0) {
+        inst->write_run_max = pci->max_payload / 4;
+    }
+    
+    if (inst->ops.apply_errata) {
+        inst->ops.apply_errata(driver, caps);
+    }
+    
+    if (pci->pcie) {
+        printf("[CHIPSET] %s: PCIe gen%u x%u (%u MB/s), MPS %u, MRRS %u, %s %u vectors\n",
+               driver->pci_address, pci->link_speed, pci->link_width,
+               pci_link_speed_mbps(pci->link_speed, pci->link_width),
+               pci->max_payload, pci->max_read_request,
+               pci->msix ? "MSI-X" : "MSI", pci->msix ? pci->msix_vectors : pci->msi_vectors);
+    }
+}
+
+/* Helper: monotonic clock in nanoseconds */
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Instance whose power transition this thread is running; its own
+ * register accesses must not wait for that transition */
+static __thread chipset_instance_t *tls_pm_transition;
+
+/* Helper: publish a runtime PM state and wake waiters (pm_lock held) */
+static void pm_set_state(chipset_instance_t *inst, uint32_t state, uint64_t now) {
+    if (state == PM_ACTIVE || state == PM_SUSPENDED) {
+        inst->pm_time_ns[inst->power_state & 3] += now - inst->pm_state_since_ns;
+        inst->pm_state_since_ns = now;
+    }
+    __atomic_store_n(&inst->pm_state, state, __ATOMIC_SEQ_CST);
+    pthread_cond_broadcast(&inst->pm_cond);
+}
+
+/* Helper: a request no longer needs the device */
+static inline void pm_put(chipset_instance_t *inst) {
+    __atomic_store_n(&inst->pm_last_active_ns, monotonic_ns(), __ATOMIC_RELAXED);
+    __atomic_sub_fetch(&inst->pm_usage, 1, __ATOMIC_SEQ_CST);
+}
+
+/* Helper: bring a runtime-suspended device back; the caller's request
+ * waits here instead of failing */
+static int pm_resume(chipset_instance_t *inst) {
+    int ret = CHIPSET_SUCCESS;
+    bool resumed = false;
+    
+    pthread_mutex_lock(&inst->pm_lock);
+    for (;;) {
+        uint32_t state = inst->pm_state;
+        if (state == PM_ACTIVE || (state == PM_SUSPENDED && !inst->pm_enabled)) {
+            break;
+        }
+        if (state != PM_SUSPENDED) {
+            pthread_cond_wait(&inst->pm_cond, &inst->pm_lock);
             continue;
         }
         
-        /* Check if it's a known chipset */
-        for (int i = 0; known_chipsets[i].name != NULL; i++) {
-            if (known_chipsets[i].vendor_id == vendor_id &&
-                known_chipsets[i].device_id == device_id) {
-                
-                chipset_driver_t *drv = &drivers[*count];
-                strncpy(drv->name, known_chipsets[i].name, sizeof(drv->name) - 1);
-                strncpy(drv->vendor, known_chipsets[i].vendor, sizeof(drv->vendor) - 1);
-                drv->vendor_id = vendor_id;
-                drv->device_id = device_id;
-                drv->chipset_type = known_chipsets[i].type;
-                drv->loaded = false;
-                drv->driver_handle = NULL;
-                drv->bridge_context = NULL;
-                
-                /* Look for Windows driver */
-                snprintf(drv->driver_path, sizeof(drv->driver_path),
-                        "/opt/windrvmgr/drivers/%04x_%04x.sys",
-                        vendor_id, device_id);
-                
-                printf("[CHIPSET] Found: %s (VID:0x%04x DID:0x%04x)\n",
-                       drv->name, vendor_id, device_id);
-                
-                (*count)++;
-                break;
+        /* This request resumes the device; later ones wait for it */
+        uint32_t from = inst->power_state;
+        uint64_t suspended_ns = monotonic_ns() - inst->pm_state_since_ns;
+        __atomic_store_n(&inst->pm_state, PM_RESUMING, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&inst->pm_lock);
+        
+        uint64_t start = monotonic_ns();
+        tls_pm_transition = inst;
+        ret = inst->ops.set_power(&inst->record, from, 0);
+        tls_pm_transition = NULL;
+        uint64_t now = monotonic_ns();
+        
+        pthread_mutex_lock(&inst->pm_lock);
+        if (ret != CHIPSET_SUCCESS) {
+            inst->pm_stats.failed_transitions++;
+            pm_set_state(inst, PM_SUSPENDED, now);
+            break;
+        }
+        
+        uint64_t latency_us = (now - start) / 1000;
+        inst->pm_stats.resumes++;
+        inst->pm_stats.resume_total_us += latency_us;
+        if (latency_us > inst->pm_stats.resume_max_us) {
+            inst->pm_stats.resume_max_us = latency_us;
+        }
+        
+        /* A suspend shorter than the idle time before it did not pay
+         * off; wait longer next time, and relax once suspends are long */
+        if (inst->pm_auto_suspended) {
+            uint64_t effective_ns = (uint64_t)inst->pm_effective_ms * 1000000ULL;
+            if (suspended_ns < effective_ns) {
+                inst->pm_stats.short_suspends++;
+                uint32_t ceiling = inst->pm_delay_ms * PM_MAX_BACKOFF;
+                inst->pm_effective_ms = inst->pm_effective_ms * 2 < ceiling ?
+                                        inst->pm_effective_ms * 2 : ceiling;
+            } else if (suspended_ns >= effective_ns * 4) {
+                inst->pm_effective_ms = inst->pm_effective_ms / 2 > inst->pm_delay_ms ?
+                                        inst->pm_effective_ms / 2 : inst->pm_delay_ms;
             }
         }
+        
+        inst->pm_auto_suspended = false;
+        __atomic_store_n(&inst->pm_last_active_ns, now, __ATOMIC_RELAXED);
+        pm_set_state(inst, PM_ACTIVE, now);
+        inst->power_state = 0;
+        resumed = true;
+        break;
     }
+    pthread_mutex_unlock(&inst->pm_lock);
     
-    closedir(dir);
+    /* The autosuspend thread stopped tracking this device when it slept */
+    if (resumed) {
+        pthread_mutex_lock(&g_chipset.lock);
+        pthread_cond_signal(&g_chipset.pm_cond);
+        pthread_mutex_unlock(&g_chipset.lock);
+    }
     
-    printf("[CHIPSET] Detected %u chipsets\n", *count);
+    return ret;
+}
+
+/* Helper: keep the device awake for a request, resuming it if needed */
+static inline int pm_get(chipset_instance_t *inst) {
+    __atomic_add_fetch(&inst->pm_usage, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&inst->pm_state, __ATOMIC_SEQ_CST) == PM_ACTIVE ||
+        tls_pm_transition == inst) {
+        return CHIPSET_SUCCESS;
+    }
     
-    return CHIPSET_SUCCESS;
+    int ret = pm_resume(inst);
+    if (ret != CHIPSET_SUCCESS) {
+        pm_put(inst);
+    }
+    return ret;
+}
+
+/* Helper: suspend an idle device if its delay has passed (pm thread,
+ * g_chipset.lock held). Returns the next time worth checking again. */
+static uint64_t pm_try_suspend(chipset_instance_t *inst, uint64_t now) {
+    uint64_t never = UINT64_MAX;
+    
+    pthread_mutex_lock(&inst->pm_lock);
+    if (!inst->pm_enabled || inst->unloading || inst->pm_state != PM_ACTIVE) {
+        pthread_mutex_unlock(&inst->pm_lock);
+        return never;
+    }
+    
+    uint64_t delay_ns = (uint64_t)inst->pm_effective_ms * 1000000ULL;
+    uint64_t due = __atomic_load_n(&inst->pm_last_active_ns, __ATOMIC_RELAXED) + delay_ns;
+    if (__atomic_load_n(&inst->pm_usage, __ATOMIC_SEQ_CST) != 0 || now < due) {
+        pthread_mutex_unlock(&inst->pm_lock);
+        return now < due ? due : now + delay_ns;
+    }
+    
+    /* Announce first, then re-check: a racing pm_get() either sees
+     * SUSPENDING and waits, or is seen here */
+    __atomic_store_n(&inst->pm_state, PM_SUSPENDING, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&inst->pm_usage, __ATOMIC_SEQ_CST) != 0) {
+        pm_set_state(inst, PM_ACTIVE, now);
+        pthread_mutex_unlock(&inst->pm_lock);
+        return now + delay_ns;
+    }
+    uint32_t target = inst->pm_suspend_state;
+    pthread_mutex_unlock(&inst->pm_lock);
+    
+    /* The transition runs without the table lock; unload waits for it */
+    pthread_mutex_unlock(&g_chipset.lock);
+    tls_pm_transition = inst;
+    int ret = inst->ops.set_power(&inst->record, 0, target);
+    tls_pm_transition = NULL;
+    pthread_mutex_lock(&g_chipset.lock);
+    
+    now = monotonic_ns();
+    pthread_mutex_lock(&inst->pm_lock);
+    if (ret == CHIPSET_SUCCESS) {
+        inst->pm_stats.suspends++;
+        inst->pm_auto_suspended = true;
+        pm_set_state(inst, PM_SUSPENDED, now);
+        inst->power_state = target;
+    } else {
+        inst->pm_stats.failed_transitions++;
+        __atomic_store_n(&inst->pm_last_active_ns, now, __ATOMIC_RELAXED);
+        pm_set_state(inst, PM_ACTIVE, now);
+        
+        /* Retrying a state the chipset cannot enter only burns wakeups */
+        if (ret == CHIPSET_ERR_NOT_SUPPORTED) {
+            inst->pm_enabled = false;
+            printf("[CHIPSET] Runtime PM disabled for %s: D%u not supported\n",
+                   inst->record.name, target);
+        }
+    }
+    pthread_mutex_unlock(&inst->pm_lock);
+    
+    return 0;
+}
+
+/* Autosuspend thread */
+static void* pm_thread_func(void *arg) {
+    (void)arg;
+    
+    pthread_mutex_lock(&g_chipset.lock);
+    while (g_chipset.pm_running) {
+        uint64_t now = monotonic_ns();
+        uint64_t next = now + PM_POLL_MAX_MS * 1000000ULL;
+        
+        uint32_t slots = g_chipset.chunk_count * CHIPSET_SLOT_CHUNK;
+        for (uint32_t i = 0; i < slots && g_chipset.pm_running; i++) {
+            chipset_instance_t *inst = slot_at(i)->inst;
+            if (!inst) {
+                continue;
+            }
+            
+            uint64_t due = pm_try_suspend(inst, now);
+            if (due == 0) {
+                /* Table lock was dropped; the slot scan restarts */
+                now = monotonic_ns();
+                slots = g_chipset.chunk_count * CHIPSET_SLOT_CHUNK;
+                i = UINT32_MAX;
+                continue;
+            }
+            if (due < next) {
+                next = due;
+            }
+        }
+        
+        struct timespec deadline = {
+            .tv_sec = (time_t)(next / 1000000000ULL),
+            .tv_nsec = (long)(next % 1000000000ULL)
+        };
+        if (g_chipset.pm_running) {
+            pthread_cond_timedwait(&g_chipset.pm_cond, &g_chipset.lock, &deadline);
+        }
+    }
+    pthread_mutex_unlock(&g_chipset.lock);
+    
+    return NULL;
+}
+
+/* Helper: stop autosuspend and undo a runtime suspend */
+static int pm_quiesce(chipset_instance_t *inst) {
+    pthread_mutex_lock(&inst->pm_lock);
+    inst->pm_enabled = false;
+    while (inst->pm_state == PM_SUSPENDING || inst->pm_state == PM_RESUMING) {
+        pthread_cond_wait(&inst->pm_cond, &inst->pm_lock);
+    }
+    bool resume = inst->pm_state == PM_SUSPENDED && inst->pm_auto_suspended;
+    pthread_mutex_unlock(&inst->pm_lock);
+    
+    return resume ? chipset_power_management(&inst->record, 0) : CHIPSET_SUCCESS;
 }
 
 /* Load chipset driver */
@@ -207,43 +987,113 @@ int chipset_load_driver(chipset_driver_t *driver) {
         return CHIPSET_ERR_INVALID_ARG;
     }
     
-    if (driver->loaded) {
+    if (instance_of(driver)) {
+        driver->loaded = true;
+        return CHIPSET_SUCCESS;
+    }
+    
+    /* One canonical record per device; later loads share it */
+    uint32_t hash = driver_key_hash(driver->vendor_id, driver->device_id, driver->pci_address);
+    pthread_mutex_lock(&g_chipset.lock);
+    chipset_instance_t *existing = hash_find(driver->vendor_id, driver->device_id,
+                                             driver->pci_address, hash);
+    if (existing) {
+        driver->loaded = true;
+        driver->driver_handle = existing->record.driver_handle;
+        driver->bridge_context = existing->record.bridge_context;
+        pthread_mutex_unlock(&g_chipset.lock);
         return CHIPSET_SUCCESS;
     }
+    pthread_mutex_unlock(&g_chipset.lock);
     
     printf("[CHIPSET] Loading driver for %s\n", driver->name);
     
-    /* Check if driver file exists */
-    struct stat st;
-    if (stat(driver->driver_path, &st) != 0) {
+    /* Map the driver image, or share the mapping another device made */
+    chipset_image_t *image = NULL;
+    if (driver->driver_path[0] == '\0') {
+        fprintf(stderr, "[CHIPSET] No driver in repository for %s\n", driver->name);
+        fprintf(stderr, "[CHIPSET] Using generic emulation instead\n");
+    } else if (!(image = chipset_image_acquire(driver->driver_path))) {
         fprintf(stderr, "[CHIPSET] Driver file not found: %s\n", driver->driver_path);
         fprintf(stderr, "[CHIPSET] Using generic emulation instead\n");
         /* Continue with emulation */
     }
     
+    chipset_instance_t *inst = (chipset_instance_t*)calloc(1, sizeof(chipset_instance_t));
+    if (!inst) {
+        chipset_image_release(image);
+        return CHIPSET_ERR_NO_MEMORY;
+    }
+    inst->image = image;
+    pthread_mutex_init(&inst->shadow_lock, NULL);
+    pthread_mutex_init(&inst->flush_lock, NULL);
+    pthread_mutex_init(&inst->posted_lock, NULL);
+    pthread_cond_init(&inst->posted_cond, NULL);
+    pthread_mutex_init(&inst->pm_lock, NULL);
+    pthread_cond_init(&inst->pm_cond, NULL);
+    inst->pm_state_since_ns = monotonic_ns();
+    inst->record = *driver;
+    inst->hash = hash;
+    bind_ops(inst);
+    discover_capabilities(inst);
+    
     /* Initialize chipset-specific handling in bridge */
     bridge_chipset_init(driver->chipset_type);
     
     /* Register with bridge */
-    driver->bridge_context = bridge_register_device(
+    inst->record.bridge_context = bridge_register_device(
         driver->device_id,
         driver->chipset_type,
         NULL,  /* Windows device object (would be created by PE loader) */
         NULL   /* Linux device handle */
     );
     
-    if (!driver->bridge_context) {
+    if (!inst->record.bridge_context) {
         fprintf(stderr, "[CHIPSET] Failed to register with bridge\n");
+        pthread_mutex_destroy(&inst->shadow_lock);
+        pthread_mutex_destroy(&inst->flush_lock);
+        pthread_mutex_destroy(&inst->posted_lock);
+        pthread_cond_destroy(&inst->posted_cond);
+        pthread_mutex_destroy(&inst->pm_lock);
+        pthread_cond_destroy(&inst->pm_cond);
+        chipset_image_release(inst->image);
+        free(inst);
         return CHIPSET_ERR_LOAD_FAILED;
     }
+    inst->record.loaded = true;
+    
+    /* Keep the device's queues and workers on its own node */
+    if (inst->record.numa_node >= 0 && inst->record.local_cpulist[0] != '\0') {
+        bridge_set_device_affinity(inst->record.bridge_context, inst->record.numa_node,
+                                   inst->record.local_cpulist);
+    }
     
-    driver->loaded = true;
-    driver->driver_handle = (void*)0xDEADBEEF; /* Placeholder */
+    /* Publish, unless a concurrent load of the same device won */
+    pthread_mutex_lock(&g_chipset.lock);
+    existing = hash_find(driver->vendor_id, driver->device_id, driver->pci_address, hash);
+    int ret = existing ? CHIPSET_SUCCESS : table_insert(inst);
+    chipset_instance_t *winner = existing ? existing : inst;
+    if (ret == CHIPSET_SUCCESS) {
+        driver->loaded = true;
+        driver->driver_handle = winner->record.driver_handle;
+        driver->bridge_context = winner->record.bridge_context;
+    }
+    pthread_mutex_unlock(&g_chipset.lock);
     
-    /* Add to loaded drivers list */
-    if (g_chipset.driver_count < 32) {
-        memcpy(&g_chipset.loaded_drivers[g_chipset.driver_count++], 
-               driver, sizeof(chipset_driver_t));
+    if (existing || ret != CHIPSET_SUCCESS) {
+        bridge_unregister_device(inst->record.bridge_context);
+        pthread_mutex_destroy(&inst->shadow_lock);
+        pthread_mutex_destroy(&inst->flush_lock);
+        pthread_mutex_destroy(&inst->posted_lock);
+        pthread_cond_destroy(&inst->posted_cond);
+        pthread_mutex_destroy(&inst->pm_lock);
+        pthread_cond_destroy(&inst->pm_cond);
+        chipset_image_release(inst->image);
+        free(inst);
+        if (ret != CHIPSET_SUCCESS) {
+            fprintf(stderr, "[CHIPSET] Driver table full\n");
+        }
+        return ret;
     }
     
     printf("[CHIPSET] Driver loaded successfully\n");
@@ -253,111 +1103,328 @@ int chipset_load_driver(chipset_driver_t *driver) {
 
 /* Unload driver */
 void chipset_unload_driver(chipset_driver_t *driver) {
-    if (!g_chipset.initialized || !driver || !driver->loaded) {
+    if (!g_chipset.initialized || !driver) {
         return;
     }
     
-    printf("[CHIPSET] Unloading driver for %s\n", driver->name);
-    
-    /* Unregister from bridge */
-    if (driver->bridge_context) {
-        bridge_unregister_device(driver->bridge_context);
-        driver->bridge_context = NULL;
+    /* Claim the canonical record; stale copies and racing unloads stop here */
+    pthread_mutex_lock(&g_chipset.lock);
+    chipset_instance_t *inst = instance_of(driver);
+    bool racing = inst && inst->unloading;
+    if (inst && !racing) {
+        inst->unloading = true;
     }
+    pthread_mutex_unlock(&g_chipset.lock);
     
-    driver->loaded = false;
-    driver->driver_handle = NULL;
-    
-    /* Remove from loaded drivers list */
-    for (uint32_t i = 0; i < g_chipset.driver_count; i++) {
-        if (g_chipset.loaded_drivers[i].device_id == driver->device_id) {
-            /* Shift remaining drivers */
-            for (uint32_t j = i; j < g_chipset.driver_count - 1; j++) {
-                memcpy(&g_chipset.loaded_drivers[j],
-                       &g_chipset.loaded_drivers[j + 1],
-                       sizeof(chipset_driver_t));
-            }
-            g_chipset.driver_count--;
-            break;
+    if (!inst || racing) {
+        /* The racing unload owns the canonical record; only copies are cleared */
+        if (!inst || driver != &inst->record) {
+            driver->loaded = false;
+            driver->driver_handle = NULL;
+            driver->bridge_context = NULL;
         }
+        return;
     }
     
+    /* The caller may pass the canonical record itself, so it stays loaded
+     * until the teardown that goes through it is done */
+    chipset_driver_t *record = &inst->record;
+    device_context_t *bridge_context = record->bridge_context;
+    printf("[CHIPSET] Unloading driver for %s\n", record->name);
+    
+    /* New calls fail from here; wait out the ones already running */
+    driver_slot_t *slot = slot_of(inst);
+    pthread_mutex_lock(&g_chipset.lock);
+    table_close(inst);
+    while (__atomic_load_n(&slot->users, __ATOMIC_SEQ_CST) != 0) {
+        pthread_cond_wait(&g_chipset.drain_cond, &g_chipset.lock);
+    }
+    pthread_mutex_unlock(&g_chipset.lock);
+    tls_unloading = inst;
+    
+    /* No more autosuspend; wake the device for the final writes */
+    pm_quiesce(inst);
+    
+    /* Write back dirty shadow registers while the device is reachable */
+    if (inst->shadow_count > 0 && chipset_shadow_flush(record) != CHIPSET_SUCCESS) {
+        fprintf(stderr, "[CHIPSET] Shadow flush failed for %s\n", record->name);
+    }
+    
+    chipset_unmap_registers(record);
+    
+    /* Unregister from bridge (waits for queued requests) */
+    if (bridge_context) {
+        bridge_unregister_device(bridge_context);
+    }
+    tls_unloading = NULL;
+    record->loaded = false;
+    record->bridge_context = NULL;
+    
+    pthread_mutex_lock(&g_chipset.lock);
+    table_remove(inst);
+    pthread_mutex_unlock(&g_chipset.lock);
+    
+    if (driver != record) {
+        driver->loaded = false;
+        driver->driver_handle = NULL;
+        driver->bridge_context = NULL;
+    }
+    
+    for (uint32_t i = 0; i < inst->shadow_count; i++) {
+        free(inst->shadow[i].values);
+        free(inst->shadow[i].staging);
+        free(inst->shadow[i].valid);
+        free(inst->shadow[i].dirty);
+    }
+    bridge_future_release(inst->flush_future);
+    pthread_mutex_destroy(&inst->shadow_lock);
+    pthread_mutex_destroy(&inst->flush_lock);
+    pthread_mutex_destroy(&inst->posted_lock);
+    pthread_cond_destroy(&inst->posted_cond);
+    pthread_mutex_destroy(&inst->pm_lock);
+    pthread_cond_destroy(&inst->pm_cond);
+    chipset_image_release(inst->image);
+    chipset_profile_destroy(inst->profile);
+    free(inst);
+    
     printf("[CHIPSET] Driver unloaded\n");
 }
 
+/* Find a loaded driver */
+int chipset_find_driver(uint32_t vendor_id, uint32_t device_id,
+                        const char *pci_address, chipset_driver_t *driver) {
+    if (!g_chipset.initialized || !driver) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    const char *address = pci_address ? pci_address : "";
+    uint32_t hash = driver_key_hash(vendor_id, device_id, address);
+    
+    /* Copied under the lock: unload unhashes the record before touching it,
+     * and frees it once the copy's calls have drained */
+    pthread_mutex_lock(&g_chipset.lock);
+    chipset_instance_t *inst = hash_find(vendor_id, device_id, address, hash);
+    if (inst) {
+        *driver = inst->record;
+    }
+    pthread_mutex_unlock(&g_chipset.lock);
+    
+    return inst ? CHIPSET_SUCCESS : CHIPSET_ERR_NOT_FOUND;
+}
+
+/* Count loaded drivers */
+uint32_t chipset_loaded_count(void) {
+    pthread_mutex_lock(&g_chipset.lock);
+    uint32_t count = g_chipset.initialized ? g_chipset.driver_count : 0;
+    pthread_mutex_unlock(&g_chipset.lock);
+    return count;
+}
+
 /* Get capabilities */
 int chipset_get_capabilities(const chipset_driver_t *driver, driver_capabilities_t *caps) {
     if (!g_chipset.initialized || !driver || !caps) {
         return CHIPSET_ERR_INVALID_ARG;
     }
     
-    /* Default capabilities based on chipset type */
-    memset(caps, 0, sizeof(driver_capabilities_t));
-    
-    switch (driver->chipset_type) {
-        case CHIPSET_INTEL:
-        case CHIPSET_AMD:
-            caps->supports_dma = true;
-            caps->supports_msi = true;
-            caps->supports_power_management = true;
-            caps->supports_pcie = true;
-            caps->max_transfer_size = 16 * 1024 * 1024;  /* 16MB */
-            caps->alignment_requirement = 4096;
-            break;
-            
-        case CHIPSET_NVIDIA:
-            caps->supports_dma = true;
-            caps->supports_msi = true;
-            caps->supports_power_management = true;
-            caps->supports_pcie = true;
-            caps->max_transfer_size = 64 * 1024 * 1024;  /* 64MB */
-            caps->alignment_requirement = 4096;
-            break;
-            
-        case CHIPSET_QUALCOMM:
-            caps->supports_dma = true;
-            caps->supports_msi = false;
-            caps->supports_power_management = true;
-            caps->supports_pcie = false;
-            caps->max_transfer_size = 4 * 1024 * 1024;   /* 4MB */
-            caps->alignment_requirement = 64;
-            break;
-            
-        default:
-            caps->max_transfer_size = 1024 * 1024;       /* 1MB */
-            caps->alignment_requirement = 64;
-            break;
+    /* Loaded drivers were probed once; others get the table defaults */
+    chipset_instance_t *inst = instance_get(driver);
+    if (inst) {
+        *caps = inst->caps;
+        instance_put(inst);
+    } else {
+        const chipset_ops_t *ops = chipset_ops_lookup(driver->vendor_id, driver->device_id,
+                                                      driver->chipset_type);
+        *caps = ops->caps;
+        if (ops->apply_errata) {
+            ops->apply_errata(driver, caps);
+        }
     }
     
     return CHIPSET_SUCCESS;
 }
 
+/* Get PCI capabilities */
+int chipset_get_pci_caps(const chipset_driver_t *driver, pci_caps_t *caps) {
+    if (!g_chipset.initialized || !driver || !caps) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = instance_get(driver);
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    bool valid = inst->pci_valid;
+    if (valid) {
+        *caps = inst->pci;
+    }
+    instance_put(inst);
+    
+    return valid ? CHIPSET_SUCCESS : CHIPSET_ERR_NOT_FOUND;
+}
+
+/* Get bound operations */
+const chipset_ops_t* chipset_get_ops(const chipset_driver_t *driver) {
+    /* The table lives as long as the driver stays loaded */
+    chipset_instance_t *inst = driver ? instance_get(driver) : NULL;
+    if (!inst) {
+        return NULL;
+    }
+    instance_put(inst);
+    return &inst->ops;
+}
+
+/* Get the driver image */
+int chipset_get_image(const chipset_driver_t *driver, const void **data, size_t *size) {
+    if (!g_chipset.initialized || !driver || !data) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    chipset_image_t *image = inst->image;
+    if (image) {
+        *data = chipset_image_data(image, size);
+    }
+    instance_put(inst);
+    
+    return image ? CHIPSET_SUCCESS : CHIPSET_ERR_NOT_FOUND;
+}
+
 /* Configure chipset */
 int chipset_configure(chipset_driver_t *driver, const char *param, uint32_t value) {
     if (!g_chipset.initialized || !driver || !param) {
         return CHIPSET_ERR_INVALID_ARG;
     }
     
-    if (!driver->loaded) {
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
         return CHIPSET_ERR_NOT_FOUND;
     }
     
     /* Forward to bridge */
+    int ret = CHIPSET_ERR_IO_ERROR;
     if (driver->bridge_context) {
-        return bridge_chipset_configure(driver->bridge_context, param, value);
+        ret = bridge_chipset_configure(driver->bridge_context, param, value);
     }
+    instance_put(inst);
     
-    return CHIPSET_ERR_IO_ERROR;
+    return ret;
 }
 
-/* Read register */
-int chipset_read_register(chipset_driver_t *driver, uint32_t offset, uint32_t *value) {
-    if (!g_chipset.initialized || !driver || !value) {
-        return CHIPSET_ERR_INVALID_ARG;
+/* Helper: per-thread future, created on first use */
+static void future_key_destroy(void *future) {
+    bridge_future_release((bridge_future_t*)future);
+}
+
+static void future_key_init(void) {
+    pthread_key_create(&g_future_key, future_key_destroy);
+}
+
+static bridge_future_t* thread_future(void) {
+    pthread_once(&g_future_once, future_key_init);
+    
+    bridge_future_t *future = (bridge_future_t*)pthread_getspecific(g_future_key);
+    if (!future) {
+        future = bridge_future_create();
+        if (future) {
+            pthread_setspecific(g_future_key, future);
+        }
+    }
+    return future;
+}
+
+/* Helper: count a finished batch of posted writes and wake barriers */
+static void posted_complete(chipset_instance_t *inst, bool ok) {
+    if (!ok) {
+        int32_t none = CHIPSET_SUCCESS;
+        __atomic_compare_exchange_n(&inst->posted_error, &none, CHIPSET_ERR_IO_ERROR,
+                                    false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
     }
     
-    if (!driver->loaded) {
-        return CHIPSET_ERR_NOT_FOUND;
+    __atomic_add_fetch(&inst->posted_done, 1, __ATOMIC_SEQ_CST);
+    pm_put(inst);
+    if (__atomic_load_n(&inst->posted_waiters, __ATOMIC_SEQ_CST) > 0) {
+        pthread_mutex_lock(&inst->posted_lock);
+        pthread_cond_broadcast(&inst->posted_cond);
+        pthread_mutex_unlock(&inst->posted_lock);
+    }
+}
+
+/* Helper: posted write batch reached the device (bridge worker) */
+static void posted_write_done(device_context_t *ctx, const bridge_completion_t *completion,
+                              void *user_data) {
+    (void)ctx;
+    posted_complete((chipset_instance_t*)user_data, completion->status == BRIDGE_SUCCESS);
+}
+
+/* Helper: queue writes without waiting. The bridge executes them in
+ * order behind everything this thread queued before, like PCIe posted
+ * writes; 4-byte payloads are copied, so callers may reuse them. */
+static int post_writes(chipset_driver_t *driver, chipset_instance_t *inst,
+                       const comm_request_t *requests, uint32_t count) {
+    if (!driver->bridge_context || pm_get(inst) != CHIPSET_SUCCESS) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    /* The device stays awake until the batch completes */
+    __atomic_add_fetch(&inst->posted_issued, 1, __ATOMIC_SEQ_CST);
+    if (bridge_submit_batch_async(driver->bridge_context, requests, count,
+                                  posted_write_done, inst) != BRIDGE_SUCCESS) {
+        /* Reported to the caller, not to the next barrier */
+        posted_complete(inst, true);
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Helper: wait for every write posted to the device so far */
+static void posted_wait(chipset_instance_t *inst) {
+    uint64_t target = __atomic_load_n(&inst->posted_issued, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&inst->posted_done, __ATOMIC_SEQ_CST) >= target) {
+        return;
+    }
+    
+    pthread_mutex_lock(&inst->posted_lock);
+    __atomic_add_fetch(&inst->posted_waiters, 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&inst->posted_done, __ATOMIC_SEQ_CST) < target) {
+        pthread_cond_wait(&inst->posted_cond, &inst->posted_lock);
+    }
+    __atomic_sub_fetch(&inst->posted_waiters, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&inst->posted_lock);
+}
+
+/* Helper: window accesses bypass the queues, so they first let posted
+ * writes land to keep PCIe ordering. Vectored writes post their pending
+ * chunk before calling this. */
+static inline void posted_order_direct(chipset_instance_t *inst) {
+    if (__atomic_load_n(&inst->posted_done, __ATOMIC_ACQUIRE) !=
+        __atomic_load_n(&inst->posted_issued, __ATOMIC_ACQUIRE)) {
+        posted_wait(inst);
+    }
+}
+
+/* Helper: read a register from the window or through the bridge */
+static int device_read(chipset_driver_t *driver, chipset_instance_t *inst, uint32_t offset,
+                       uint32_t *value, uint32_t timeout_us) {
+    /* Registers declared safe are loaded straight from the window */
+    if (direct_access(inst, offset)) {
+        posted_order_direct(inst);
+        *value = *(volatile uint32_t*)(inst->mmio + offset);
+        return CHIPSET_SUCCESS;
+    }
+    
+    if (!driver->bridge_context) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    bridge_future_t *future = thread_future();
+    if (!future) {
+        return CHIPSET_ERR_NO_MEMORY;
     }
     
     /* Create request */
@@ -372,30 +1439,36 @@ int chipset_read_register(chipset_driver_t *driver, uint32_t offset, uint32_t *v
         .priority = 5
     };
     
-    /* Forward through bridge */
-    if (driver->bridge_context) {
-        int ret = bridge_forward_request(driver->bridge_context, &req);
-        if (ret == BRIDGE_SUCCESS) {
-            /* Simulate read value */
-            *value = 0x12345678;
-            printf("[CHIPSET] Read register 0x%x from device 0x%x: 0x%x\n",
-                   offset, driver->device_id, *value);
-            return CHIPSET_SUCCESS;
-        }
+    /* Forward through bridge and wait for the backend's value */
+    if (bridge_submit_future(driver->bridge_context, &req, future) != BRIDGE_SUCCESS) {
         return CHIPSET_ERR_IO_ERROR;
     }
     
-    return CHIPSET_ERR_IO_ERROR;
-}
-
-/* Write register */
-int chipset_write_register(chipset_driver_t *driver, uint32_t offset, uint32_t value) {
-    if (!g_chipset.initialized || !driver) {
-        return CHIPSET_ERR_INVALID_ARG;
+    bridge_completion_t completion;
+    if (bridge_future_wait(future, timeout_us, &completion) != BRIDGE_SUCCESS) {
+        /* Still in flight: the bridge frees it on completion */
+        bridge_future_release(future);
+        pthread_setspecific(g_future_key, NULL);
+        return CHIPSET_ERR_TIMEOUT;
     }
     
-    if (!driver->loaded) {
-        return CHIPSET_ERR_NOT_FOUND;
+    if (completion.status != BRIDGE_SUCCESS) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    *value = (uint32_t)completion.value;
+    printf("[CHIPSET] Read register 0x%x from device 0x%x: 0x%x\n",
+           offset, driver->device_id, *value);
+    return CHIPSET_SUCCESS;
+}
+
+/* Helper: write a register to the window or through the bridge */
+static int device_write(chipset_driver_t *driver, chipset_instance_t *inst, uint32_t offset,
+                        uint32_t value) {
+    if (direct_access(inst, offset)) {
+        posted_order_direct(inst);
+        *(volatile uint32_t*)(inst->mmio + offset) = value;
+        return CHIPSET_SUCCESS;
     }
     
     /* Create request */
@@ -413,34 +1486,1436 @@ int chipset_write_register(chipset_driver_t *driver, uint32_t offset, uint32_t v
         .priority = 5
     };
     
-    /* Forward through bridge */
-    if (driver->bridge_context) {
-        int ret = bridge_forward_request(driver->bridge_context, &req);
-        if (ret == BRIDGE_SUCCESS) {
-            printf("[CHIPSET] Wrote register 0x%x to device 0x%x: 0x%x\n",
-                   offset, driver->device_id, value);
+    /* Posted: returns once queued */
+    int ret = post_writes(driver, inst, &req, 1);
+    if (ret == CHIPSET_SUCCESS) {
+        printf("[CHIPSET] Wrote register 0x%x to device 0x%x: 0x%x\n",
+               offset, driver->device_id, value);
+    }
+    
+    return ret;
+}
+
+/* Generic register read */
+static int generic_read_register(chipset_driver_t *driver, uint32_t offset, uint32_t *value,
+                                 uint32_t timeout_us) {
+    return device_read(driver, instance_of(driver), offset, value, timeout_us);
+}
+
+/* Generic register write */
+static int generic_write_register(chipset_driver_t *driver, uint32_t offset, uint32_t value) {
+    return device_write(driver, instance_of(driver), offset, value);
+}
+
+/* Generic power change with the PCI PM recovery times */
+static int generic_set_power(chipset_driver_t *driver, uint32_t from, uint32_t to) {
+    if (!driver->bridge_context) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    if (bridge_chipset_power_state(driver->bridge_context, to) != BRIDGE_SUCCESS) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    /* Device must not be accessed until it has recovered */
+    if (to == 0 && from == 3) {
+        usleep(10000);
+    } else if (to == 0 && from == 2) {
+        usleep(200);
+    }
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Defaults for chipsets without a vendor table */
+const chipset_ops_t chipset_generic_ops = {
+    .name = "generic",
+    .caps = {
+        .max_transfer_size = 1024 * 1024,
+        .alignment_requirement = 64
+    },
+    .batch_size = CHIPSET_SUBMIT_BATCH,
+    .read_register = generic_read_register,
+    .write_register = generic_write_register,
+    .set_power = generic_set_power,
+    .apply_errata = NULL
+};
+
+/* Helper: read one register through the shadow, waking the device if needed */
+static int register_read(chipset_driver_t *driver, chipset_instance_t *inst, uint32_t offset,
+                         uint32_t *value, uint32_t timeout_us) {
+    /* Cached registers are served from the shadow */
+    uint32_t index = 0;
+    shadow_range_t *range = shadow_lookup(inst, offset, &index);
+    if (range) {
+        pthread_mutex_lock(&inst->shadow_lock);
+        bool hit = (range->valid[BIT_WORD(index)] & BIT_MASK(index)) != 0;
+        if (hit) {
+            *value = range->values[index];
+            inst->shadow_stats.hits++;
+        } else {
+            inst->shadow_stats.misses++;
+        }
+        pthread_mutex_unlock(&inst->shadow_lock);
+        
+        if (hit) {
             return CHIPSET_SUCCESS;
         }
+    }
+    
+    if (pm_get(inst) != CHIPSET_SUCCESS) {
         return CHIPSET_ERR_IO_ERROR;
     }
+    int ret = inst->ops.read_register(driver, offset, value, timeout_us);
+    pm_put(inst);
+    
+    /* Fill unless a write raced ahead of us */
+    if (ret == CHIPSET_SUCCESS && range) {
+        pthread_mutex_lock(&inst->shadow_lock);
+        if (!(range->valid[BIT_WORD(index)] & BIT_MASK(index))) {
+            range->values[index] = *value;
+            range->valid[BIT_WORD(index)] |= BIT_MASK(index);
+        }
+        pthread_mutex_unlock(&inst->shadow_lock);
+    }
     
-    return CHIPSET_ERR_IO_ERROR;
+    return ret;
 }
 
-/* Power management */
-int chipset_power_management(chipset_driver_t *driver, uint32_t state) {
+/* Helper: write one register through the shadow, waking the device if needed */
+static int register_write(chipset_driver_t *driver, chipset_instance_t *inst, uint32_t offset,
+                          uint32_t value) {
+    uint32_t index = 0;
+    shadow_range_t *range = shadow_lookup(inst, offset, &index);
+    
+    /* Write-back registers stay in the shadow and leave the device asleep */
+    bool reaches_device = !range || range->policy != CHIPSET_CACHE_WRITE_BACK;
+    if (reaches_device && pm_get(inst) != CHIPSET_SUCCESS) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    if (!range) {
+        int ret = inst->ops.write_register(driver, offset, value);
+        pm_put(inst);
+        return ret;
+    }
+    
+    /* Device write stays under the lock so shadow and device agree on order */
+    int ret = CHIPSET_SUCCESS;
+    pthread_mutex_lock(&inst->shadow_lock);
+    switch (range->policy) {
+        case CHIPSET_CACHE_WRITE_BACK:
+            range->values[index] = value;
+            range->valid[BIT_WORD(index)] |= BIT_MASK(index);
+            range->dirty[BIT_WORD(index)] |= BIT_MASK(index);
+            inst->shadow_stats.absorbed_writes++;
+            break;
+            
+        case CHIPSET_CACHE_WRITE_THROUGH:
+            range->values[index] = value;
+            range->valid[BIT_WORD(index)] |= BIT_MASK(index);
+            ret = inst->ops.write_register(driver, offset, value);
+            break;
+            
+        default:
+            /* The device may transform the value; read it back next time */
+            range->valid[BIT_WORD(index)] &= ~BIT_MASK(index);
+            ret = inst->ops.write_register(driver, offset, value);
+            break;
+    }
+    pthread_mutex_unlock(&inst->shadow_lock);
+    
+    if (reaches_device) {
+        pm_put(inst);
+    }
+    
+    return ret;
+}
+
+/* Read register */
+int chipset_read_register(chipset_driver_t *driver, uint32_t offset, uint32_t *value) {
+    return chipset_read_register_timeout(driver, offset, value, 0);
+}
+
+/* Read register with timeout */
+int chipset_read_register_timeout(chipset_driver_t *driver, uint32_t offset,
+                                  uint32_t *value, uint32_t timeout_us) {
+    if (!g_chipset.initialized || !driver || !value) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret;
+    if (!__atomic_load_n(&inst->profiling, __ATOMIC_ACQUIRE)) {
+        ret = register_read(driver, inst, offset, value, timeout_us);
+    } else {
+        uint64_t start = monotonic_ns();
+        ret = register_read(driver, inst, offset, value, timeout_us);
+        chipset_profile_record(inst->profile, offset, false, monotonic_ns() - start);
+    }
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Write register */
+int chipset_write_register(chipset_driver_t *driver, uint32_t offset, uint32_t value) {
     if (!g_chipset.initialized || !driver) {
         return CHIPSET_ERR_INVALID_ARG;
     }
     
-    if (!driver->loaded) {
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
         return CHIPSET_ERR_NOT_FOUND;
     }
     
-    /* Forward to bridge */
-    if (driver->bridge_context) {
-        return bridge_chipset_power_state(driver->bridge_context, state);
+    int ret;
+    if (!__atomic_load_n(&inst->profiling, __ATOMIC_ACQUIRE)) {
+        ret = register_write(driver, inst, offset, value);
+    } else {
+        uint64_t start = monotonic_ns();
+        ret = register_write(driver, inst, offset, value);
+        chipset_profile_record(inst->profile, offset, true, monotonic_ns() - start);
+    }
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Helper: submit a batch on the thread future and wait for it */
+static int submit_batch_wait(chipset_driver_t *driver, bridge_future_t *future,
+                             const comm_request_t *requests, uint32_t count) {
+    if (bridge_submit_batch_future(driver->bridge_context, requests, count,
+                                   future) != BRIDGE_SUCCESS) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    bridge_completion_t completion;
+    if (bridge_future_wait(future, 0, &completion) != BRIDGE_SUCCESS) {
+        /* Still in flight: the bridge frees it (and its buffer) on completion */
+        bridge_future_release(future);
+        pthread_setspecific(g_future_key, NULL);
+        return CHIPSET_ERR_TIMEOUT;
+    }
+    
+    return completion.status == BRIDGE_SUCCESS ? CHIPSET_SUCCESS : CHIPSET_ERR_IO_ERROR;
+}
+
+/* Helper: vectored read on a pinned instance */
+static int registers_read(chipset_driver_t *driver, chipset_instance_t *inst,
+                          chipset_reg_t *regs, uint32_t count) {
+    comm_request_t requests[CHIPSET_SUBMIT_BATCH];
+    uint32_t slots[CHIPSET_SUBMIT_BATCH];
+    
+    uint32_t i = 0;
+    while (i < count) {
+        /* Cached and direct registers are answered in place; the rest
+         * of this chunk goes out as one submission. A chunk ends before
+         * the first in-place register so accesses stay in array order. */
+        uint32_t n = 0;
+        for (; i < count && n < inst->ops.batch_size; i++) {
+            uint32_t index = 0;
+            shadow_range_t *range = shadow_lookup(inst, regs[i].offset, &index);
+            if (range) {
+                pthread_mutex_lock(&inst->shadow_lock);
+                bool hit = (range->valid[BIT_WORD(index)] & BIT_MASK(index)) != 0;
+                if (hit && n == 0) {
+                    regs[i].value = range->values[index];
+                    inst->shadow_stats.hits++;
+                } else if (!hit) {
+                    inst->shadow_stats.misses++;
+                }
+                pthread_mutex_unlock(&inst->shadow_lock);
+                if (hit && n > 0) {
+                    break;
+                }
+                if (hit) {
+                    continue;
+                }
+            }
+            
+            if (direct_access(inst, regs[i].offset)) {
+                if (n > 0) {
+                    break;
+                }
+                if (pm_get(inst) != CHIPSET_SUCCESS) {
+                    return CHIPSET_ERR_IO_ERROR;
+                }
+                posted_order_direct(inst);
+                regs[i].value = *(volatile uint32_t*)(inst->mmio + regs[i].offset);
+                pm_put(inst);
+                continue;
+            }
+            
+            slots[n] = i;
+            requests[n] = (comm_request_t){
+                .type = REQ_IO_READ,
+                .device_id = driver->device_id,
+                .address = regs[i].offset,
+                .size = 4,
+                .data = NULL,
+                .flags = 0,
+                .timestamp = 0,
+                .priority = 5
+            };
+            n++;
+        }
+        
+        if (n == 0) {
+            continue;
+        }
+        
+        if (!driver->bridge_context) {
+            return CHIPSET_ERR_IO_ERROR;
+        }
+        
+        /* Values land in the future's buffer, which outlives a timeout */
+        bridge_future_t *future = thread_future();
+        uint32_t *values = (uint32_t*)bridge_future_buffer(future, n * sizeof(uint32_t));
+        if (!values) {
+            return CHIPSET_ERR_NO_MEMORY;
+        }
+        for (uint32_t k = 0; k < n; k++) {
+            requests[k].data = (uint8_t*)&values[k];
+        }
+        
+        if (pm_get(inst) != CHIPSET_SUCCESS) {
+            return CHIPSET_ERR_IO_ERROR;
+        }
+        int ret = submit_batch_wait(driver, future, requests, n);
+        pm_put(inst);
+        if (ret != CHIPSET_SUCCESS) {
+            return ret;
+        }
+        
+        for (uint32_t k = 0; k < n; k++) {
+            chipset_reg_t *reg = &regs[slots[k]];
+            reg->value = values[k];
+            
+            uint32_t index = 0;
+            shadow_range_t *range = shadow_lookup(inst, reg->offset, &index);
+            if (range) {
+                pthread_mutex_lock(&inst->shadow_lock);
+                if (!(range->valid[BIT_WORD(index)] & BIT_MASK(index))) {
+                    range->values[index] = reg->value;
+                    range->valid[BIT_WORD(index)] |= BIT_MASK(index);
+                }
+                pthread_mutex_unlock(&inst->shadow_lock);
+            }
+        }
+        
+        printf("[CHIPSET] Read %u registers from device 0x%x in one submission\n",
+               n, driver->device_id);
     }
     
-    return CHIPSET_ERR_IO_ERROR;
+    return CHIPSET_SUCCESS;
+}
+
+/* Helper: vectored write on a pinned instance */
+static int registers_write(chipset_driver_t *driver, chipset_instance_t *inst,
+                           const chipset_reg_t *regs, uint32_t count) {
+    comm_request_t requests[CHIPSET_SUBMIT_BATCH];
+    
+    uint32_t i = 0;
+    while (i < count) {
+        /* As for reads, a chunk ends before the first register handled
+         * in place so it cannot overtake writes still to be posted */
+        uint32_t n = 0;
+        for (; i < count && n < inst->ops.batch_size; i++) {
+            uint32_t index = 0;
+            shadow_range_t *range = shadow_lookup(inst, regs[i].offset, &index);
+            if (range) {
+                bool absorbed = range->policy == CHIPSET_CACHE_WRITE_BACK;
+                if (absorbed && n > 0) {
+                    break;
+                }
+                
+                pthread_mutex_lock(&inst->shadow_lock);
+                if (range->policy == CHIPSET_CACHE_CACHEABLE) {
+                    range->valid[BIT_WORD(index)] &= ~BIT_MASK(index);
+                } else {
+                    range->values[index] = regs[i].value;
+                    range->valid[BIT_WORD(index)] |= BIT_MASK(index);
+                }
+                if (absorbed) {
+                    range->dirty[BIT_WORD(index)] |= BIT_MASK(index);
+                    inst->shadow_stats.absorbed_writes++;
+                }
+                pthread_mutex_unlock(&inst->shadow_lock);
+                if (absorbed) {
+                    continue;
+                }
+            }
+            
+            if (direct_access(inst, regs[i].offset)) {
+                if (n > 0) {
+                    break;
+                }
+                if (pm_get(inst) != CHIPSET_SUCCESS) {
+                    return CHIPSET_ERR_IO_ERROR;
+                }
+                posted_order_direct(inst);
+                *(volatile uint32_t*)(inst->mmio + regs[i].offset) = regs[i].value;
+                pm_put(inst);
+                continue;
+            }
+            
+            /* 4-byte payloads are copied into the queue entry */
+            requests[n] = (comm_request_t){
+                .type = REQ_IO_WRITE,
+                .device_id = driver->device_id,
+                .address = regs[i].offset,
+                .size = 4,
+                .data = (uint8_t*)&regs[i].value,
+                .flags = 0,
+                .timestamp = 0,
+                .priority = 5
+            };
+            n++;
+        }
+        
+        if (n == 0) {
+            continue;
+        }
+        
+        /* Posted, so long programming sequences stream without round trips */
+        int ret = post_writes(driver, inst, requests, n);
+        if (ret != CHIPSET_SUCCESS) {
+            return ret;
+        }
+        
+        printf("[CHIPSET] Posted %u registers to device 0x%x in one submission\n",
+               n, driver->device_id);
+    }
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Read registers */
+int chipset_read_registers(chipset_driver_t *driver, chipset_reg_t *regs, uint32_t count) {
+    if (!g_chipset.initialized || !driver || !regs) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret = registers_read(driver, inst, regs, count);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Write registers */
+int chipset_write_registers(chipset_driver_t *driver, const chipset_reg_t *regs,
+                            uint32_t count) {
+    if (!g_chipset.initialized || !driver || !regs) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret = registers_write(driver, inst, regs, count);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Helper: end of the segment starting at @start */
+static uint64_t segment_end(uint64_t start, uint64_t end, uint32_t max, uint32_t align) {
+    /* Whole alignment units, unless the limit is below one unit */
+    uint64_t chunk = (align > 1 && max >= align) ? max - max % align : max;
+    uint64_t limit = end - start > chunk ? start + chunk : end;
+    
+    /* A misaligned start only runs to the next boundary */
+    if (align > 1 && start % align != 0) {
+        uint64_t boundary = start - start % align + align;
+        if (boundary < limit) {
+            limit = boundary;
+        }
+    }
+    return limit;
+}
+
+/* Helper: copy @length bytes between the list at the cursor and @flat */
+static void sg_stage(const comm_sg_entry_t *sg, uint32_t *elem, uint32_t *elem_off,
+                     uint8_t *flat, uint64_t length, bool gather) {
+    while (length > 0) {
+        if (*elem_off == sg[*elem].length) {
+            (*elem)++;
+            *elem_off = 0;
+            continue;
+        }
+        uint32_t take = sg[*elem].length - *elem_off;
+        if (take > length) {
+            take = (uint32_t)length;
+        }
+        if (gather) {
+            memcpy(flat, sg[*elem].data + *elem_off, take);
+        } else {
+            memcpy(sg[*elem].data + *elem_off, flat, take);
+        }
+        flat += take;
+        *elem_off += take;
+        length -= take;
+    }
+}
+
+/* Helper: scatter-gather transfer on a pinned instance */
+static int transfer(chipset_driver_t *driver, chipset_instance_t *inst, bool write,
+                    uint64_t address, const comm_sg_entry_t *sg, uint32_t sg_count) {
+    if (!driver->bridge_context) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < sg_count; i++) {
+        if (!sg[i].data && sg[i].length > 0) {
+            return CHIPSET_ERR_INVALID_ARG;
+        }
+        total += sg[i].length;
+    }
+    if (total == 0) {
+        return CHIPSET_SUCCESS;
+    }
+    if (address + total < address) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    uint32_t max = inst->caps.max_transfer_size ? inst->caps.max_transfer_size : UINT32_MAX;
+    uint32_t align = inst->caps.alignment_requirement;
+    
+    bridge_future_t *future = thread_future();
+    if (!future) {
+        return CHIPSET_ERR_NO_MEMORY;
+    }
+    
+    /* Segments at the device limits, a batch (and about a window) per
+     * submission. Data is staged in the future's buffer, which outlives
+     * a timeout, so a late batch never touches the caller's list. */
+    comm_request_t requests[CHIPSET_SUBMIT_BATCH];
+    uint32_t batch = inst->ops.batch_size;
+    uint64_t end = address + total;
+    uint64_t start = address;
+    uint32_t segments = 0;
+    uint32_t elem = 0;
+    uint32_t elem_off = 0;
+    
+    if (pm_get(inst) != CHIPSET_SUCCESS) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    int ret = CHIPSET_SUCCESS;
+    while (ret == CHIPSET_SUCCESS && start < end) {
+        uint32_t n = 0;
+        uint64_t bytes = 0;
+        for (uint64_t seg = start; seg < end && n < batch; n++) {
+            uint64_t seg_end = segment_end(seg, end, max, align);
+            if (n > 0 && bytes + (seg_end - seg) > CHIPSET_TRANSFER_WINDOW) {
+                break;
+            }
+            requests[n] = (comm_request_t){
+                .type = write ? REQ_IO_WRITE : REQ_IO_READ,
+                .device_id = driver->device_id,
+                .address = seg,
+                .size = (uint32_t)(seg_end - seg),
+                .data = NULL,
+                .flags = 0,
+                .timestamp = 0,
+                .priority = 5
+            };
+            bytes += seg_end - seg;
+            seg = seg_end;
+        }
+        
+        uint8_t *stage = (uint8_t*)bridge_future_buffer(future, (size_t)bytes);
+        if (!stage) {
+            ret = CHIPSET_ERR_NO_MEMORY;
+            break;
+        }
+        uint64_t off = 0;
+        for (uint32_t k = 0; k < n; k++) {
+            requests[k].data = stage + off;
+            off += requests[k].size;
+        }
+        
+        if (write) {
+            sg_stage(sg, &elem, &elem_off, stage, bytes, true);
+        }
+        ret = submit_batch_wait(driver, future, requests, n);
+        if (ret == CHIPSET_SUCCESS && !write) {
+            sg_stage(sg, &elem, &elem_off, stage, bytes, false);
+        }
+        
+        segments += n;
+        start += bytes;
+    }
+    pm_put(inst);
+    
+    if (ret == CHIPSET_SUCCESS) {
+        printf("[CHIPSET] %s %llu bytes at 0x%llx on device 0x%x in %u segments\n",
+               write ? "Wrote" : "Read", (unsigned long long)total,
+               (unsigned long long)address, driver->device_id, segments);
+    }
+    
+    return ret;
+}
+
+/* Scatter-gather transfer */
+int chipset_transfer(chipset_driver_t *driver, bool write, uint64_t address,
+                     const comm_sg_entry_t *sg, uint32_t sg_count) {
+    if (!g_chipset.initialized || !driver || !sg || sg_count == 0) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret = transfer(driver, inst, write, address, sg, sg_count);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Read a block */
+int chipset_read_block(chipset_driver_t *driver, uint64_t address, void *buffer,
+                       uint32_t length) {
+    comm_sg_entry_t entry = {(uint8_t*)buffer, length};
+    return chipset_transfer(driver, false, address, &entry, 1);
+}
+
+/* Write a block */
+int chipset_write_block(chipset_driver_t *driver, uint64_t address, const void *buffer,
+                        uint32_t length) {
+    comm_sg_entry_t entry = {(uint8_t*)buffer, length};
+    return chipset_transfer(driver, true, address, &entry, 1);
+}
+
+/* Set shadow policy */
+int chipset_shadow_set_policy(chipset_driver_t *driver, uint32_t offset, uint32_t length,
+                              chipset_cache_policy_t policy) {
+    if (!g_chipset.initialized || !driver || length == 0 ||
+        (offset & 3) != 0 || (length & 3) != 0 ||
+        (uint64_t)offset + length > UINT32_MAX || policy > CHIPSET_CACHE_WRITE_BACK) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    uint32_t regs = length / 4;
+    uint32_t words = (regs + 63) / 64;
+    int ret = CHIPSET_SUCCESS;
+    
+    pthread_mutex_lock(&inst->shadow_lock);
+    for (uint32_t i = 0; i < inst->shadow_count; i++) {
+        if (offset < inst->shadow[i].end && offset + length > inst->shadow[i].start) {
+            ret = CHIPSET_ERR_INVALID_ARG;
+            break;
+        }
+    }
+    if (ret == CHIPSET_SUCCESS && inst->shadow_count >= CHIPSET_MAX_SHADOW_RANGES) {
+        ret = CHIPSET_ERR_NO_MEMORY;
+    }
+    
+    if (ret == CHIPSET_SUCCESS) {
+        shadow_range_t *range = &inst->shadow[inst->shadow_count];
+        range->start = offset;
+        range->end = offset + length;
+        range->policy = policy;
+        range->values = (uint32_t*)calloc(regs, sizeof(uint32_t));
+        range->staging = (uint32_t*)calloc(regs, sizeof(uint32_t));
+        range->valid = (uint64_t*)calloc(words, sizeof(uint64_t));
+        range->dirty = (uint64_t*)calloc(words, sizeof(uint64_t));
+        
+        if (!range->values || !range->staging || !range->valid || !range->dirty) {
+            free(range->values);
+            free(range->staging);
+            free(range->valid);
+            free(range->dirty);
+            memset(range, 0, sizeof(*range));
+            ret = CHIPSET_ERR_NO_MEMORY;
+        } else {
+            __atomic_store_n(&inst->shadow_count, inst->shadow_count + 1, __ATOMIC_RELEASE);
+        }
+    }
+    pthread_mutex_unlock(&inst->shadow_lock);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Helper: wait for a flush that previously timed out */
+static int flush_wait(chipset_instance_t *inst) {
+    if (!inst->flush_inflight) {
+        return CHIPSET_SUCCESS;
+    }
+    
+    bridge_completion_t completion;
+    if (bridge_future_wait(inst->flush_future, 0, &completion) != BRIDGE_SUCCESS) {
+        return CHIPSET_ERR_TIMEOUT;
+    }
+    inst->flush_inflight = false;
+    
+    return completion.status == BRIDGE_SUCCESS ? CHIPSET_SUCCESS : CHIPSET_ERR_IO_ERROR;
+}
+
+/* Helper: flush dirty registers (flush_lock held) */
+static int flush_locked(chipset_driver_t *driver, chipset_instance_t *inst) {
+    comm_request_t requests[CHIPSET_SUBMIT_BATCH];
+    struct {
+        shadow_range_t *range;
+        uint32_t first;
+        uint32_t count;
+    } runs[CHIPSET_SUBMIT_BATCH];
+    
+    int ret = flush_wait(inst);
+    if (ret != CHIPSET_SUCCESS) {
+        return ret;
+    }
+    
+    if (!inst->flush_future && !(inst->flush_future = bridge_future_create())) {
+        return CHIPSET_ERR_NO_MEMORY;
+    }
+    
+    for (;;) {
+        /* Snapshot dirty runs into staging; each run becomes one write */
+        uint32_t n = 0;
+        uint64_t registers = 0;
+        pthread_mutex_lock(&inst->shadow_lock);
+        for (uint32_t r = 0; r < inst->shadow_count && n < inst->ops.batch_size; r++) {
+            shadow_range_t *range = &inst->shadow[r];
+            if (range->policy != CHIPSET_CACHE_WRITE_BACK) {
+                continue;
+            }
+            
+            uint32_t regs = (range->end - range->start) / 4;
+            uint32_t i = 0;
+            while (i < regs && n < inst->ops.batch_size) {
+                if (range->dirty[BIT_WORD(i)] == 0) {
+                    i = (BIT_WORD(i) + 1) * 64;
+                    continue;
+                }
+                if (!(range->dirty[BIT_WORD(i)] & BIT_MASK(i))) {
+                    i++;
+                    continue;
+                }
+                
+                uint32_t first = i;
+                while (i < regs && (range->dirty[BIT_WORD(i)] & BIT_MASK(i)) &&
+                       (inst->write_run_max == 0 || i - first < inst->write_run_max)) {
+                    range->staging[i] = range->values[i];
+                    range->dirty[BIT_WORD(i)] &= ~BIT_MASK(i);
+                    i++;
+                }
+                
+                runs[n].range = range;
+                runs[n].first = first;
+                runs[n].count = i - first;
+                requests[n] = (comm_request_t){
+                    .type = REQ_IO_WRITE,
+                    .device_id = driver->device_id,
+                    .address = range->start + first * 4,
+                    .size = (i - first) * 4,
+                    .data = (uint8_t*)&range->staging[first],
+                    .flags = 0,
+                    .timestamp = 0,
+                    .priority = 5
+                };
+                registers += i - first;
+                n++;
+            }
+        }
+        pthread_mutex_unlock(&inst->shadow_lock);
+        
+        if (n == 0) {
+            break;
+        }
+        
+        bool awake = pm_get(inst) == CHIPSET_SUCCESS;
+        if (!awake || bridge_submit_batch_future(driver->bridge_context, requests, n,
+                                                 inst->flush_future) != BRIDGE_SUCCESS) {
+            if (awake) {
+                pm_put(inst);
+            }
+            
+            /* Nothing was sent; mark the runs dirty again */
+            pthread_mutex_lock(&inst->shadow_lock);
+            for (uint32_t k = 0; k < n; k++) {
+                for (uint32_t i = runs[k].first; i < runs[k].first + runs[k].count; i++) {
+                    runs[k].range->dirty[BIT_WORD(i)] |= BIT_MASK(i);
+                }
+            }
+            pthread_mutex_unlock(&inst->shadow_lock);
+            return CHIPSET_ERR_IO_ERROR;
+        }
+        
+        pthread_mutex_lock(&inst->shadow_lock);
+        inst->shadow_stats.flush_requests += n;
+        inst->shadow_stats.flushed_registers += registers;
+        pthread_mutex_unlock(&inst->shadow_lock);
+        
+        /* Staging is reused by the next round, so wait for this one */
+        inst->flush_inflight = true;
+        ret = flush_wait(inst);
+        pm_put(inst);
+        if (ret != CHIPSET_SUCCESS) {
+            return ret;
+        }
+    }
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Flush write-back registers */
+int chipset_shadow_flush(chipset_driver_t *driver) {
+    if (!g_chipset.initialized || !driver) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    if (!driver->bridge_context) {
+        instance_put(inst);
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    pthread_mutex_lock(&inst->flush_lock);
+    int ret = flush_locked(driver, inst);
+    if (ret == CHIPSET_SUCCESS) {
+        pthread_mutex_lock(&inst->shadow_lock);
+        inst->shadow_stats.flushes++;
+        pthread_mutex_unlock(&inst->shadow_lock);
+    }
+    pthread_mutex_unlock(&inst->flush_lock);
+    instance_put(inst);
+    
+    if (ret == CHIPSET_SUCCESS) {
+        printf("[CHIPSET] Flushed shadow registers for %s\n", driver->name);
+    }
+    
+    return ret;
+}
+
+/* Invalidate shadow */
+int chipset_shadow_invalidate(chipset_driver_t *driver) {
+    if (!g_chipset.initialized || !driver) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    /* Dirty registers keep their values until flushed */
+    pthread_mutex_lock(&inst->shadow_lock);
+    for (uint32_t r = 0; r < inst->shadow_count; r++) {
+        shadow_range_t *range = &inst->shadow[r];
+        uint32_t words = ((range->end - range->start) / 4 + 63) / 64;
+        for (uint32_t w = 0; w < words; w++) {
+            range->valid[w] = range->dirty[w];
+        }
+    }
+    pthread_mutex_unlock(&inst->shadow_lock);
+    instance_put(inst);
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Get shadow statistics */
+int chipset_shadow_get_stats(chipset_driver_t *driver, chipset_shadow_stats_t *stats) {
+    if (!g_chipset.initialized || !driver || !stats) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    pthread_mutex_lock(&inst->shadow_lock);
+    *stats = inst->shadow_stats;
+    pthread_mutex_unlock(&inst->shadow_lock);
+    instance_put(inst);
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Helper: drop the register window */
+static void unmap_window(chipset_instance_t *inst) {
+    if (!inst->mmio) {
+        return;
+    }
+    
+    munmap((void*)inst->mmio, inst->mmio_size);
+    inst->mmio = NULL;
+    inst->mmio_size = 0;
+    inst->direct_count = 0;
+}
+
+/* Helper: map a register window from an open descriptor */
+static int map_window(chipset_driver_t *driver, chipset_instance_t *inst, int fd) {
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        fprintf(stderr, "[CHIPSET] Register window has no size\n");
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        perror("[CHIPSET] mmap");
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    unmap_window(inst);
+    inst->mmio = (volatile uint8_t*)base;
+    inst->mmio_size = (size_t)st.st_size;
+    
+    printf("[CHIPSET] Mapped %zu byte register window for %s\n",
+           inst->mmio_size, driver->name);
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Map PCI BAR */
+int chipset_map_bar(chipset_driver_t *driver, uint32_t bar) {
+    if (!g_chipset.initialized || !driver || bar > 5) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    if (driver->pci_address[0] == '\0') {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    char path[512];
+    snprintf(path, sizeof(path), "/sys/bus/pci/devices/%s/resource%u",
+             driver->pci_address, bar);
+    
+    int fd = open(path, O_RDWR | O_SYNC | O_CLOEXEC);
+    if (fd < 0) {
+        fprintf(stderr, "[CHIPSET] Cannot open %s\n", path);
+        instance_put(inst);
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret = map_window(driver, inst, fd);
+    close(fd);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Map stand-in register file */
+int chipset_map_file(chipset_driver_t *driver, int fd) {
+    if (!g_chipset.initialized || !driver || fd < 0) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret = map_window(driver, inst, fd);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Unmap register window */
+void chipset_unmap_registers(chipset_driver_t *driver) {
+    if (!driver || !driver->loaded) {
+        return;
+    }
+    
+    chipset_instance_t *inst = instance_get(driver);
+    if (!inst) {
+        return;
+    }
+    
+    unmap_window(inst);
+    instance_put(inst);
+}
+
+/* Declare direct-access range */
+int chipset_set_direct_range(chipset_driver_t *driver, uint32_t offset, uint32_t length) {
+    if (!g_chipset.initialized || !driver || length == 0) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    /* Whole registers inside the window only */
+    int ret = CHIPSET_SUCCESS;
+    if (!inst->mmio) {
+        ret = CHIPSET_ERR_NOT_FOUND;
+    } else if ((offset & 3) != 0 || (length & 3) != 0 ||
+               (uint64_t)offset + length > inst->mmio_size) {
+        ret = CHIPSET_ERR_INVALID_ARG;
+    } else if (inst->direct_count >= CHIPSET_MAX_DIRECT_RANGES) {
+        ret = CHIPSET_ERR_NO_MEMORY;
+    } else {
+        inst->direct[inst->direct_count].start = offset;
+        inst->direct[inst->direct_count].end = offset + length;
+        inst->direct_count++;
+    }
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* In-flight async register operation */
+typedef struct {
+    chipset_driver_t *driver;
+    chipset_instance_t *inst;
+    chipset_completion_fn callback;
+    void *user_data;
+    shadow_range_t *range;
+    uint32_t index;
+    uint32_t offset;
+    uint32_t value;
+} chipset_async_op_t;
+
+/* Helper: translate a bridge completion into the caller's callback */
+static void async_register_done(device_context_t *ctx,
+                                const bridge_completion_t *completion,
+                                void *user_data) {
+    (void)ctx;
+    chipset_async_op_t *op = (chipset_async_op_t*)user_data;
+    
+    int status = completion->status == BRIDGE_SUCCESS ?
+                 CHIPSET_SUCCESS : CHIPSET_ERR_IO_ERROR;
+    uint32_t value = completion->type == REQ_IO_READ ?
+                     (uint32_t)completion->value : op->value;
+    
+    /* Reads fill the shadow like synchronous ones; an uncached write
+     * drops any value a read picked up while it was queued */
+    shadow_range_t *range = op->range;
+    if (range) {
+        pthread_mutex_lock(&op->inst->shadow_lock);
+        if (completion->type == REQ_IO_READ) {
+            if (status == CHIPSET_SUCCESS &&
+                !(range->valid[BIT_WORD(op->index)] & BIT_MASK(op->index))) {
+                range->values[op->index] = value;
+                range->valid[BIT_WORD(op->index)] |= BIT_MASK(op->index);
+            }
+        } else if (range->policy == CHIPSET_CACHE_CACHEABLE) {
+            range->valid[BIT_WORD(op->index)] &= ~BIT_MASK(op->index);
+        }
+        pthread_mutex_unlock(&op->inst->shadow_lock);
+    }
+    
+    pm_put(op->inst);
+    op->callback(op->driver, status, op->offset, value, op->user_data);
+    free(op);
+}
+
+/* Helper: queue a register request on a pinned instance */
+static int queue_register_async(chipset_driver_t *driver, chipset_instance_t *inst,
+                                request_type_t type, uint32_t offset, uint32_t value,
+                                chipset_completion_fn callback, void *user_data) {
+    /* Shadow hits and absorbed writes complete before returning */
+    uint32_t index = 0;
+    shadow_range_t *range = shadow_lookup(inst, offset, &index);
+    if (range) {
+        bool done = false;
+        pthread_mutex_lock(&inst->shadow_lock);
+        if (type == REQ_IO_READ) {
+            done = (range->valid[BIT_WORD(index)] & BIT_MASK(index)) != 0;
+            if (done) {
+                value = range->values[index];
+                inst->shadow_stats.hits++;
+            } else {
+                inst->shadow_stats.misses++;
+            }
+        } else if (range->policy == CHIPSET_CACHE_WRITE_BACK) {
+            range->values[index] = value;
+            range->valid[BIT_WORD(index)] |= BIT_MASK(index);
+            range->dirty[BIT_WORD(index)] |= BIT_MASK(index);
+            inst->shadow_stats.absorbed_writes++;
+            done = true;
+        }
+        pthread_mutex_unlock(&inst->shadow_lock);
+        
+        if (done) {
+            callback(driver, CHIPSET_SUCCESS, offset, value, user_data);
+            return CHIPSET_SUCCESS;
+        }
+    }
+    
+    if (!driver->bridge_context) {
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    chipset_async_op_t *op = (chipset_async_op_t*)malloc(sizeof(chipset_async_op_t));
+    if (!op) {
+        return CHIPSET_ERR_NO_MEMORY;
+    }
+    op->driver = driver;
+    op->inst = inst;
+    op->callback = callback;
+    op->user_data = user_data;
+    op->range = range;
+    op->index = index;
+    op->offset = offset;
+    op->value = value;
+    
+    /* Write payloads are copied into the bridge queue on submission */
+    comm_request_t req = {
+        .type = type,
+        .device_id = driver->device_id,
+        .address = offset,
+        .size = 4,
+        .data = type == REQ_IO_WRITE ? (uint8_t*)&value : NULL,
+        .flags = 0,
+        .timestamp = 0,
+        .priority = 5
+    };
+    
+    if (pm_get(inst) != CHIPSET_SUCCESS) {
+        free(op);
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    if (!range || type == REQ_IO_READ) {
+        if (bridge_submit_async(driver->bridge_context, &req,
+                                async_register_done, op) != BRIDGE_SUCCESS) {
+            pm_put(inst);
+            free(op);
+            return CHIPSET_ERR_IO_ERROR;
+        }
+        return CHIPSET_SUCCESS;
+    }
+    
+    /* Submitted under the lock so shadow and device agree on order */
+    int ret = CHIPSET_SUCCESS;
+    pthread_mutex_lock(&inst->shadow_lock);
+    if (range->policy == CHIPSET_CACHE_WRITE_THROUGH) {
+        range->values[index] = value;
+        range->valid[BIT_WORD(index)] |= BIT_MASK(index);
+    } else {
+        range->valid[BIT_WORD(index)] &= ~BIT_MASK(index);
+    }
+    if (bridge_submit_async(driver->bridge_context, &req,
+                            async_register_done, op) != BRIDGE_SUCCESS) {
+        ret = CHIPSET_ERR_IO_ERROR;
+    }
+    pthread_mutex_unlock(&inst->shadow_lock);
+    
+    if (ret != CHIPSET_SUCCESS) {
+        pm_put(inst);
+        free(op);
+    }
+    
+    return ret;
+}
+
+/* Helper: submit a register request with a completion callback */
+static int submit_register_async(chipset_driver_t *driver, request_type_t type,
+                                 uint32_t offset, uint32_t value,
+                                 chipset_completion_fn callback, void *user_data) {
+    if (!g_chipset.initialized || !driver || !callback) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    /* Queued operations outlive the pin; unregistering the device drains them */
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret = queue_register_async(driver, inst, type, offset, value, callback, user_data);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Async read register */
+int chipset_read_register_async(chipset_driver_t *driver, uint32_t offset,
+                                chipset_completion_fn callback, void *user_data) {
+    return submit_register_async(driver, REQ_IO_READ, offset, 0, callback, user_data);
+}
+
+/* Async write register */
+int chipset_write_register_async(chipset_driver_t *driver, uint32_t offset,
+                                 uint32_t value, chipset_completion_fn callback,
+                                 void *user_data) {
+    return submit_register_async(driver, REQ_IO_WRITE, offset, value, callback, user_data);
+}
+
+/* Power management */
+int chipset_power_management(chipset_driver_t *driver, uint32_t state) {
+    if (!g_chipset.initialized || !driver || state > 3) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    /* Vendor sequencing around the bridge's state change, after the
+     * writes that prepared it */
+    posted_wait(inst);
+    
+    /* Runtime transitions finish first; requests wait for this one */
+    pthread_mutex_lock(&inst->pm_lock);
+    while (inst->pm_state == PM_SUSPENDING || inst->pm_state == PM_RESUMING) {
+        pthread_cond_wait(&inst->pm_cond, &inst->pm_lock);
+    }
+    uint32_t from = inst->power_state;
+    __atomic_store_n(&inst->pm_state, state == 0 ? PM_RESUMING : PM_SUSPENDING,
+                     __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&inst->pm_lock);
+    
+    tls_pm_transition = inst;
+    int ret = inst->ops.set_power(driver, from, state);
+    tls_pm_transition = NULL;
+    
+    uint64_t now = monotonic_ns();
+    pthread_mutex_lock(&inst->pm_lock);
+    if (ret == CHIPSET_SUCCESS) {
+        pm_set_state(inst, state == 0 ? PM_ACTIVE : PM_SUSPENDED, now);
+        inst->power_state = state;
+        inst->pm_auto_suspended = false;
+    } else {
+        inst->pm_stats.failed_transitions++;
+        pm_set_state(inst, from == 0 ? PM_ACTIVE : PM_SUSPENDED, now);
+    }
+    __atomic_store_n(&inst->pm_last_active_ns, now, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&inst->pm_lock);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Enable runtime PM */
+int chipset_runtime_pm_enable(chipset_driver_t *driver, const chipset_runtime_pm_t *config) {
+    if (!g_chipset.initialized || !driver) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    uint32_t delay_ms = config && config->autosuspend_delay_ms ?
+                        config->autosuspend_delay_ms : PM_DEFAULT_DELAY_MS;
+    uint32_t suspend_state = config && config->suspend_state ? config->suspend_state : 3;
+    if (suspend_state > 3) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    pthread_mutex_lock(&inst->pm_lock);
+    inst->pm_delay_ms = delay_ms;
+    inst->pm_effective_ms = delay_ms;
+    inst->pm_suspend_state = suspend_state;
+    inst->pm_enabled = true;
+    __atomic_store_n(&inst->pm_last_active_ns, monotonic_ns(), __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&inst->pm_lock);
+    
+    /* One thread serves every device */
+    int ret = CHIPSET_SUCCESS;
+    pthread_mutex_lock(&g_chipset.lock);
+    if (!g_chipset.pm_running) {
+        g_chipset.pm_running = true;
+        if (pthread_create(&g_chipset.pm_thread, NULL, pm_thread_func, NULL) != 0) {
+            g_chipset.pm_running = false;
+            ret = CHIPSET_ERR_NO_MEMORY;
+        }
+    }
+    pthread_cond_signal(&g_chipset.pm_cond);
+    pthread_mutex_unlock(&g_chipset.lock);
+    
+    if (ret != CHIPSET_SUCCESS) {
+        pthread_mutex_lock(&inst->pm_lock);
+        inst->pm_enabled = false;
+        pthread_mutex_unlock(&inst->pm_lock);
+    } else {
+        printf("[CHIPSET] Runtime PM enabled for %s: D%u after %u ms idle\n",
+               driver->name, suspend_state, delay_ms);
+    }
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Disable runtime PM */
+int chipset_runtime_pm_disable(chipset_driver_t *driver) {
+    if (!g_chipset.initialized || !driver) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret = pm_quiesce(inst);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Get power management statistics */
+int chipset_get_pm_stats(const chipset_driver_t *driver, chipset_pm_stats_t *stats) {
+    if (!g_chipset.initialized || !driver || !stats) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    uint64_t now = monotonic_ns();
+    
+    pthread_mutex_lock(&inst->pm_lock);
+    *stats = inst->pm_stats;
+    stats->power_state = inst->power_state;
+    stats->runtime_enabled = inst->pm_enabled;
+    stats->autosuspend_delay_ms = inst->pm_effective_ms;
+    for (uint32_t d = 0; d < 4; d++) {
+        uint64_t ns = inst->pm_time_ns[d];
+        if (d == inst->power_state) {
+            ns += now - inst->pm_state_since_ns;
+        }
+        stats->time_in_state_ms[d] = ns / 1000000ULL;
+    }
+    pthread_mutex_unlock(&inst->pm_lock);
+    instance_put(inst);
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Enable register profiling */
+int chipset_profile_enable(chipset_driver_t *driver, bool enable) {
+    if (!g_chipset.initialized || !driver) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    if (!enable) {
+        __atomic_store_n(&inst->profiling, false, __ATOMIC_RELEASE);
+        instance_put(inst);
+        return CHIPSET_SUCCESS;
+    }
+    
+    /* Recorders may still hold the old profile, so it is cleared, not freed */
+    chipset_profile_t *profile = __atomic_load_n(&inst->profile, __ATOMIC_ACQUIRE);
+    if (!profile) {
+        chipset_profile_t *created = chipset_profile_create();
+        if (!created) {
+            instance_put(inst);
+            return CHIPSET_ERR_NO_MEMORY;
+        }
+        if (!__atomic_compare_exchange_n(&inst->profile, &profile, created, false,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            chipset_profile_destroy(created);
+        } else {
+            profile = created;
+        }
+    }
+    chipset_profile_reset(profile);
+    __atomic_store_n(&inst->profiling, true, __ATOMIC_RELEASE);
+    instance_put(inst);
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Get register profile */
+int chipset_get_profile(const chipset_driver_t *driver, chipset_profile_entry_t *entries,
+                        uint32_t max_entries, uint32_t *count) {
+    if (!g_chipset.initialized || !driver || !entries || !count) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    int ret = CHIPSET_ERR_NOT_FOUND;
+    chipset_profile_t *profile = __atomic_load_n(&inst->profile, __ATOMIC_ACQUIRE);
+    if (profile) {
+        *count = chipset_profile_top(profile, entries, max_entries);
+        ret = CHIPSET_SUCCESS;
+    }
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Format register heatmap */
+int chipset_profile_heatmap(const chipset_driver_t *driver, char *buf, size_t size) {
+    if (!g_chipset.initialized || !driver || (!buf && size > 0)) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    chipset_profile_t *profile = __atomic_load_n(&inst->profile, __ATOMIC_ACQUIRE);
+    if (!profile) {
+        instance_put(inst);
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    char title[128];
+    snprintf(title, sizeof(title), "Register heatmap for %s%s%s", inst->record.name,
+             inst->record.pci_address[0] ? " at " : "", inst->record.pci_address);
+    
+    int ret = chipset_profile_format(profile, title, buf, size);
+    instance_put(inst);
+    
+    return ret;
+}
+
+/* Wait for posted writes */
+int chipset_barrier(chipset_driver_t *driver) {
+    if (!g_chipset.initialized || !driver) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_instance_t *inst = driver->loaded ? instance_get(driver) : NULL;
+    if (!inst) {
+        return CHIPSET_ERR_NOT_FOUND;
+    }
+    
+    posted_wait(inst);
+    int ret = __atomic_exchange_n(&inst->posted_error, CHIPSET_SUCCESS, __ATOMIC_ACQ_REL);
+    instance_put(inst);
+    
+    return ret;
 }
@@ -53,8 +53,13 @@
 #define CHIPSET_DRIVER_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include <stdbool.h>
 #include "../kernel_bridge/kernel_bridge.h"
+#include "pci_caps.h"
+
+#define CHIPSET_MAX_DIRECT_RANGES   8
+#define CHIPSET_MAX_SHADOW_RANGES   16
 
 /* Chipset driver information */
 typedef struct {
@@ -64,6 +69,10 @@ typedef struct {
     uint32_t device_id;
     chipset_type_t chipset_type;
     char driver_path[256];
+    char pci_address[16];       /* Domain:bus:device.function, empty if unknown */
+    int32_t numa_node;          /* -1 if unknown */
+    char local_cpulist[64];     /* CPUs near the device, empty if unknown */
+    char root_port[16];         /* Topmost upstream bridge, empty on a root bus */
     bool loaded;
     void *driver_handle;
     device_context_t *bridge_context;
@@ -79,6 +88,66 @@ typedef struct {
     uint32_t alignment_requirement;
 } driver_capabilities_t;
 
+/* Register access for vectored reads and writes */
+typedef struct {
+    uint32_t offset;
+    uint32_t value;
+} chipset_reg_t;
+
+/* Shadow register cache policy */
+typedef enum {
+    CHIPSET_CACHE_VOLATILE = 0,     /* Every access reaches the device */
+    CHIPSET_CACHE_CACHEABLE,        /* Reads cached; writes go to the device and
+                                     * drop the cached value */
+    CHIPSET_CACHE_WRITE_THROUGH,    /* Reads cached; writes update cache and device */
+    CHIPSET_CACHE_WRITE_BACK        /* Writes held until chipset_shadow_flush() */
+} chipset_cache_policy_t;
+
+/* Shadow register cache statistics */
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t absorbed_writes;       /* Write-back writes held in the shadow */
+    uint64_t flushes;
+    uint64_t flush_requests;        /* Coalesced writes sent to the bridge */
+    uint64_t flushed_registers;
+} chipset_shadow_stats_t;
+
+/* Runtime power management settings */
+typedef struct {
+    uint32_t autosuspend_delay_ms;  /* Idle time before suspending (0 = 2000) */
+    uint32_t suspend_state;         /* D-state to suspend to, 1-3 (0 = 3) */
+} chipset_runtime_pm_t;
+
+/* Power management statistics */
+typedef struct {
+    uint32_t power_state;           /* Current D-state */
+    bool runtime_enabled;
+    uint32_t autosuspend_delay_ms;  /* Effective delay, after thrash backoff */
+    uint64_t suspends;              /* Automatic suspends */
+    uint64_t resumes;               /* Automatic resumes */
+    uint64_t short_suspends;        /* Resumed sooner than the delay */
+    uint64_t failed_transitions;
+    uint64_t resume_total_us;
+    uint64_t resume_max_us;
+    uint64_t time_in_state_ms[4];   /* D0-D3 since load */
+} chipset_pm_stats_t;
+
+/* Register access profile of one offset (sketch estimates, may overcount) */
+typedef struct {
+    uint32_t offset;
+    uint64_t reads;
+    uint64_t writes;
+    uint64_t read_avg_ns;           /* Mean latency seen by the caller */
+    uint64_t write_avg_ns;
+} chipset_profile_entry_t;
+
+/* Async completion callback, called on a bridge worker thread; must not block.
+ * @status is CHIPSET_SUCCESS or a negative CHIPSET_ERR_* code. */
+typedef void (*chipset_completion_fn)(chipset_driver_t *driver, int status,
+                                      uint32_t offset, uint32_t value,
+                                      void *user_data);
+
 /* API Functions */
 
 /**
@@ -103,29 +172,105 @@ void chipset_shutdown(void);
  */
 int chipset_detect(chipset_driver_t *drivers, uint32_t max_drivers, uint32_t *count);
 
+/**
+ * chipset_identify - Fill a driver record for a known chipset
+ * @vendor_id: PCI vendor ID
+ * @device_id: PCI device ID
+ * @pci_address: Domain:bus:device.function (may be NULL)
+ * @driver: Output record (not loaded)
+ * 
+ * driver_path comes from the driver repository index, matched on the
+ * function's subsystem and class as well when @pci_address is enumerated.
+ * With an index open, it is empty if no rule matches; with no index, it
+ * is the conventional CHIPSET_REPO_DIR_DEFAULT/vvvv_dddd.sys name.
+ * Enumerated functions also get their NUMA node, local CPUs and root
+ * port.
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_NOT_FOUND if the chipset is unknown
+ */
+int chipset_identify(uint32_t vendor_id, uint32_t device_id, const char *pci_address,
+                     chipset_driver_t *driver);
+
 /**
  * chipset_load_driver - Load a chipset driver
  * @driver: Driver to load
  * 
+ * The subsystem keeps one canonical record per (vendor_id, device_id,
+ * pci_address); @driver receives its handle. Loading a device that is
+ * already loaded shares the existing record.
+ * 
  * Returns: 0 on success, negative on error
  */
 int chipset_load_driver(chipset_driver_t *driver);
 
 /**
  * chipset_unload_driver - Unload a chipset driver
- * @driver: Driver to unload
+ * @driver: Driver to unload (any record holding its handle)
+ * 
+ * Other copies of the record go stale and fail with CHIPSET_ERR_NOT_FOUND.
+ * Calls already running on the driver finish before it is torn down; calls
+ * made after the unload starts fail with CHIPSET_ERR_NOT_FOUND.
  */
 void chipset_unload_driver(chipset_driver_t *driver);
 
+/**
+ * chipset_find_driver - Look up a loaded driver
+ * @vendor_id: PCI vendor ID
+ * @device_id: PCI device ID
+ * @pci_address: Domain:bus:device.function (NULL or "" if unknown)
+ * @driver: Receives a copy of the driver's record
+ * 
+ * The copy holds the driver's handle, so it can be used (and unloaded)
+ * like the record that loaded it, and goes stale the same way.
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_NOT_FOUND if not loaded
+ */
+int chipset_find_driver(uint32_t vendor_id, uint32_t device_id,
+                        const char *pci_address, chipset_driver_t *driver);
+
+/**
+ * chipset_loaded_count - Number of loaded drivers
+ * 
+ * Returns: Loaded driver count
+ */
+uint32_t chipset_loaded_count(void);
+
 /**
  * chipset_get_capabilities - Get driver capabilities
  * @driver: Driver to query
  * @caps: Output capabilities
  * 
+ * For a loaded driver with a PCI address these come from the device's
+ * config space, probed once at load: MSI/MSI-X, power management, PCIe,
+ * and DMA from the device class. Alignment and max_transfer_size, and
+ * anything config space does not settle, are the defaults for the
+ * chipset type.
+ * 
  * Returns: 0 on success, negative on error
  */
 int chipset_get_capabilities(const chipset_driver_t *driver, driver_capabilities_t *caps);
 
+/**
+ * chipset_get_pci_caps - Get the probed PCI capabilities
+ * @driver: Loaded driver
+ * @caps: Output capabilities
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_NOT_FOUND if not loaded or not probed
+ */
+int chipset_get_pci_caps(const chipset_driver_t *driver, pci_caps_t *caps);
+
+/**
+ * chipset_get_image - Get the driver image a loaded driver runs from
+ * @driver: Loaded driver
+ * @data: Output read-only contents, shared with other devices using the
+ *        same file and valid until the driver is unloaded
+ * @size: Output size in bytes (may be NULL)
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_NOT_FOUND if the driver is not
+ * loaded or runs without an image (generic emulation)
+ */
+int chipset_get_image(const chipset_driver_t *driver, const void **data, size_t *size);
+
 /**
  * chipset_configure - Configure chipset parameters
  * @driver: Driver to configure
@@ -146,25 +291,332 @@ int chipset_configure(chipset_driver_t *driver, const char *param, uint32_t valu
  */
 int chipset_read_register(chipset_driver_t *driver, uint32_t offset, uint32_t *value);
 
+/**
+ * chipset_read_register_timeout - Read chipset register with a deadline
+ * @driver: Driver context
+ * @offset: Register offset
+ * @value: Output value returned by the bridge backend
+ * @timeout_us: Maximum wait (0 = bridge sync_timeout_us)
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_TIMEOUT if the backend did not
+ * answer in time, other negative values on error
+ */
+int chipset_read_register_timeout(chipset_driver_t *driver, uint32_t offset,
+                                  uint32_t *value, uint32_t timeout_us);
+
 /**
  * chipset_write_register - Write chipset register
  * @driver: Driver context
  * @offset: Register offset
  * @value: Value to write
  * 
- * Returns: 0 on success, negative on error
+ * The write is posted: it returns once queued, and writes from one
+ * thread reach the device in program order. A later read from the same
+ * thread is ordered behind them, as on PCIe; use chipset_barrier() to
+ * wait for completion or to order against other threads.
+ * 
+ * Returns: 0 on success, negative on error (failures after queueing are
+ * reported by chipset_barrier())
  */
 int chipset_write_register(chipset_driver_t *driver, uint32_t offset, uint32_t value);
 
+/**
+ * chipset_read_registers - Read many registers in one bridge round trip
+ * @driver: Driver context
+ * @regs: Registers to read; each value is filled in
+ * @count: Number of registers
+ * 
+ * Registers not served by the shadow cache or the direct window are
+ * submitted as one batch (per 64 registers) with a single completion,
+ * and executed in array order.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_read_registers(chipset_driver_t *driver, chipset_reg_t *regs, uint32_t count);
+
+/**
+ * chipset_write_registers - Write many registers in one bridge round trip
+ * @driver: Driver context
+ * @regs: Offsets and values to write, in program order
+ * @count: Number of registers
+ * 
+ * Batched like chipset_read_registers() and posted like
+ * chipset_write_register(), so a programming sequence is streamed
+ * without waiting for the device. Write-back registers are only updated
+ * in the shadow.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_write_registers(chipset_driver_t *driver, const chipset_reg_t *regs,
+                            uint32_t count);
+
+/**
+ * chipset_barrier - Wait for posted writes to reach the device
+ * @driver: Driver context
+ * 
+ * Covers every write posted to the device before the call, from any
+ * thread. Dirty write-back shadow registers are not writes yet; use
+ * chipset_shadow_flush() for those. Must not be called from a
+ * completion callback.
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_IO_ERROR if a posted write failed
+ * since the last barrier, other negative values on error
+ */
+int chipset_barrier(chipset_driver_t *driver);
+
+/**
+ * chipset_transfer - Move a block through a scatter-gather list
+ * @driver: Driver context
+ * @write: Transfer to the device (true) or from it (false)
+ * @address: Device address of the first byte
+ * @sg: Buffers, filled or drained in list order
+ * @sg_count: Number of list entries
+ * 
+ * The transfer is split into segments no longer than the device's
+ * max_transfer_size, with boundaries on its alignment_requirement (a
+ * misaligned start gets a short head segment). Segments go out in
+ * batches of up to 64, staged through a buffer the bridge owns, and each
+ * batch waits at most the sync timeout. After CHIPSET_ERR_TIMEOUT a late
+ * batch completes into that buffer, never into @sg, and how much of the
+ * block was moved is unknown.
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_TIMEOUT, or negative on error
+ */
+int chipset_transfer(chipset_driver_t *driver, bool write, uint64_t address,
+                     const comm_sg_entry_t *sg, uint32_t sg_count);
+
+/**
+ * chipset_read_block - Read a contiguous block
+ * @driver: Driver context
+ * @address: Device address
+ * @buffer: Output buffer
+ * @length: Bytes to read
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_read_block(chipset_driver_t *driver, uint64_t address, void *buffer,
+                       uint32_t length);
+
+/**
+ * chipset_write_block - Write a contiguous block
+ * @driver: Driver context
+ * @address: Device address
+ * @buffer: Data to write
+ * @length: Bytes to write
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_write_block(chipset_driver_t *driver, uint64_t address, const void *buffer,
+                        uint32_t length);
+
+/**
+ * chipset_read_register_async - Read chipset register without waiting
+ * @driver: Driver context (must stay loaded until the callback runs)
+ * @offset: Register offset
+ * @callback: Called with the value read by the backend, or from the
+ *            shadow file before this returns on a cache hit
+ * @user_data: Passed to @callback
+ * 
+ * Returns: 0 if submitted, negative on error (the callback is not called)
+ */
+int chipset_read_register_async(chipset_driver_t *driver, uint32_t offset,
+                                chipset_completion_fn callback, void *user_data);
+
+/**
+ * chipset_write_register_async - Write chipset register without waiting
+ * @driver: Driver context (must stay loaded until the callback runs)
+ * @offset: Register offset
+ * @value: Value to write
+ * @callback: Called when the backend has performed the write, or
+ *            before this returns for a write-back register
+ * @user_data: Passed to @callback
+ * 
+ * Returns: 0 if submitted, negative on error (the callback is not called)
+ */
+int chipset_write_register_async(chipset_driver_t *driver, uint32_t offset,
+                                 uint32_t value, chipset_completion_fn callback,
+                                 void *user_data);
+
+/**
+ * chipset_map_bar - Map a PCI BAR for direct register access
+ * @driver: Loaded driver with a known pci_address
+ * @bar: BAR index (0-5), mapped from sysfs resourceN
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_map_bar(chipset_driver_t *driver, uint32_t bar);
+
+/**
+ * chipset_map_file - Map a regular file or memfd as the register window
+ * @driver: Loaded driver
+ * @fd: Open read/write descriptor; its size is the window size. The
+ *      caller keeps ownership of @fd.
+ * 
+ * Stand-in for a BAR when testing without hardware.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_map_file(chipset_driver_t *driver, int fd);
+
+/**
+ * chipset_unmap_registers - Drop the register window and its direct ranges
+ * @driver: Driver context
+ */
+void chipset_unmap_registers(chipset_driver_t *driver);
+
+/**
+ * chipset_set_direct_range - Declare registers safe for direct access
+ * @driver: Driver with a mapped window
+ * @offset: First register (4-byte aligned)
+ * @length: Range length in bytes (multiple of 4)
+ * 
+ * chipset_read_register()/chipset_write_register() access registers in
+ * these ranges with volatile loads/stores instead of bridge requests.
+ * A direct access first waits for writes already posted to the device,
+ * including earlier entries of the same chipset_write_registers() call;
+ * it is not ordered against async requests. Must not race with
+ * chipset_unmap_registers().
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_set_direct_range(chipset_driver_t *driver, uint32_t offset, uint32_t length);
+
+/**
+ * chipset_shadow_set_policy - Cache a register range in the shadow file
+ * @driver: Loaded driver
+ * @offset: First register (4-byte aligned)
+ * @length: Range length in bytes (multiple of 4)
+ * @policy: How reads and writes in the range are cached
+ * 
+ * Ranges may not overlap. Applies to the synchronous, vectored and
+ * async register calls; async reads served from the shadow and async
+ * writes absorbed by it call their callback before returning.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_shadow_set_policy(chipset_driver_t *driver, uint32_t offset, uint32_t length,
+                              chipset_cache_policy_t policy);
+
+/**
+ * chipset_shadow_flush - Write dirty write-back registers to the device
+ * @driver: Driver context
+ * 
+ * Adjacent dirty registers are coalesced into one bridge write and all
+ * writes are submitted as a batch. Returns once the device has them.
+ * Also called on unload.
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_TIMEOUT if the writes are still in
+ * flight, other negative values on error
+ */
+int chipset_shadow_flush(chipset_driver_t *driver);
+
+/**
+ * chipset_shadow_invalidate - Drop clean cached register values
+ * @driver: Driver context
+ * 
+ * Dirty registers are kept until flushed.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_shadow_invalidate(chipset_driver_t *driver);
+
+/**
+ * chipset_shadow_get_stats - Get shadow register cache statistics
+ * @driver: Driver context
+ * @stats: Output statistics
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_shadow_get_stats(chipset_driver_t *driver, chipset_shadow_stats_t *stats);
+
 /**
  * chipset_power_management - Control chipset power state
  * @driver: Driver context
  * @state: Power state (0=D0 full power, 3=D3 off)
  * 
- * Returns: 0 on success, negative on error
+ * Waits for posted writes first. With runtime PM enabled, a device put
+ * into a low-power state here is resumed by its next request.
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_NOT_SUPPORTED if the chipset cannot
+ *          enter @state (it stays where it was), negative on error
  */
 int chipset_power_management(chipset_driver_t *driver, uint32_t state);
 
+/**
+ * chipset_runtime_pm_enable - Suspend the device automatically when idle
+ * @driver: Driver context
+ * @config: Settings, or NULL for defaults
+ * 
+ * The device is idle while no request is in flight. Once it has been
+ * idle for the autosuspend delay it is moved to the suspend state; the
+ * next request resumes it to D0 and is held, not failed, until the
+ * device is back. A suspend cut short by a resume doubles the delay (up
+ * to 16 times the configured value), and suspends that pay off halve it
+ * again, so bursty traffic does not thrash between states. A chipset
+ * that refuses the suspend state turns runtime PM back off.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_runtime_pm_enable(chipset_driver_t *driver, const chipset_runtime_pm_t *config);
+
+/**
+ * chipset_runtime_pm_disable - Stop automatic suspend
+ * @driver: Driver context
+ * 
+ * Resumes the device if runtime PM had suspended it.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_runtime_pm_disable(chipset_driver_t *driver);
+
+/**
+ * chipset_get_pm_stats - Get power management statistics
+ * @driver: Driver context
+ * @stats: Output statistics
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_get_pm_stats(const chipset_driver_t *driver, chipset_pm_stats_t *stats);
+
+/**
+ * chipset_profile_enable - Profile register accesses of a device
+ * @driver: Driver context
+ * @enable: Start (clearing any earlier profile) or stop recording
+ * 
+ * chipset_read_register() and chipset_write_register() then record counts
+ * and latencies per offset in a fixed-size count-min sketch that keeps the
+ * hottest registers. Recording is lock-free; stopped profiles keep their
+ * data until the next start.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_profile_enable(chipset_driver_t *driver, bool enable);
+
+/**
+ * chipset_get_profile - Get the hottest registers of a device
+ * @driver: Driver context
+ * @entries: Output, hottest first
+ * @max_entries: Size of @entries
+ * @count: Number of entries returned
+ * 
+ * Returns: 0 on success, CHIPSET_ERR_NOT_FOUND if never profiled
+ */
+int chipset_get_profile(const chipset_driver_t *driver, chipset_profile_entry_t *entries,
+                        uint32_t max_entries, uint32_t *count);
+
+/**
+ * chipset_profile_heatmap - Format the profile as a register heatmap
+ * @driver: Driver context
+ * @buf: Output text, one line per hot register in offset order
+ * @size: Size of @buf
+ * 
+ * Each line carries the access counts, latencies, a heat bar and a hint
+ * (cache, post or map) for read-mostly, write-mostly and mixed registers.
+ * 
+ * Returns: Length of the full report (as snprintf), negative on error
+ */
+int chipset_profile_heatmap(const chipset_driver_t *driver, char *buf, size_t size);
+
 /* Error codes */
 #define CHIPSET_SUCCESS          0
 #define CHIPSET_ERR_NOT_INIT     -1
@@ -173,5 +625,7 @@ int chipset_power_management(chipset_driver_t *driver, uint32_t state);
 #define CHIPSET_ERR_NOT_FOUND    -4
 #define CHIPSET_ERR_LOAD_FAILED  -5
 #define CHIPSET_ERR_IO_ERROR     -6
+#define CHIPSET_ERR_TIMEOUT      -7
+#define CHIPSET_ERR_NOT_SUPPORTED -8
 
 #endif /* CHIPSET_DRIVER_H */
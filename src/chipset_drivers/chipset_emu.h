@@ -0,0 +1,146 @@
+/*
+ * ParrotWinKernel - Chipset Emulator
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Emulator
+ * 
+ * Deterministic device models for the known chipsets, installed as the
+ * bridge backend so the whole stack can be benchmarked without hardware.
+ * Each model has a register map with reset values and side effects
+ * (write-1-to-clear, read-to-clear, self-clearing reset, a counter that
+ * advances on read), interrupts on status changes, and a DMA engine with
+ * a fixed latency and bandwidth behind block transfers.
+ */
+
+#ifndef CHIPSET_EMU_H
+#define CHIPSET_EMU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../kernel_bridge/kernel_bridge.h"
+#include "chipset_driver.h"
+
+/* Register map shared by every model (4-byte accesses) */
+#define CHIPSET_EMU_REG_ID          0x000   /* RO: device << 16 | vendor */
+#define CHIPSET_EMU_REG_REVISION    0x004   /* RO */
+#define CHIPSET_EMU_REG_CONTROL     0x008   /* RW */
+#define CHIPSET_EMU_REG_STATUS      0x00C   /* Write 1 to clear */
+#define CHIPSET_EMU_REG_INT_MASK    0x010   /* RW: status bits that interrupt */
+#define CHIPSET_EMU_REG_INT_CAUSE   0x014   /* Read to clear: bits that interrupted */
+#define CHIPSET_EMU_REG_COUNTER     0x018   /* RO: advances on every read */
+#define CHIPSET_EMU_REG_SCRATCH     0x01C   /* RW */
+#define CHIPSET_EMU_REG_DMA_COUNT   0x020   /* RO: completed DMA transfers */
+#define CHIPSET_EMU_REG_SPACE       0x1000  /* Register window, offsets wrap */
+
+/* CONTROL bits */
+#define CHIPSET_EMU_CTRL_ENABLE     0x00000001  /* Clear to make DMA fail */
+#define CHIPSET_EMU_CTRL_RESET      0x80000000  /* Restore reset values, self-clearing */
+
+/* STATUS bits (interrupt vector = bit number) */
+#define CHIPSET_EMU_STS_DMA_DONE    0x00000001
+#define CHIPSET_EMU_STS_DMA_ERROR   0x00000002
+#define CHIPSET_EMU_STS_RESET_DONE  0x00000004
+
+/* Interrupt handler, called on a bridge worker thread; must not block */
+typedef void (*chipset_emu_irq_fn)(uint32_t device_id, uint32_t vector, void *user_data);
+
+/* Emulator configuration */
+typedef struct {
+    bool realtime;                  /* Sleep for emulated time, not just account it */
+    uint32_t dma_mbytes_per_sec;    /* DMA bandwidth for every model (0 = model value) */
+    uint32_t dma_latency_us;        /* DMA setup latency for every model (0 = model value) */
+    uint32_t register_latency_ns;   /* Register access cost for every model (0 = model value) */
+    uint32_t memory_size;           /* Device memory behind block transfers (0 = 256 KB) */
+    chipset_emu_irq_fn irq_handler; /* Optional */
+    void *irq_user_data;
+} chipset_emu_config_t;
+
+/* Per-device emulator statistics */
+typedef struct {
+    uint64_t register_reads;
+    uint64_t register_writes;
+    uint64_t dma_transfers;
+    uint64_t dma_bytes;
+    uint64_t dma_errors;
+    uint64_t interrupts;
+    uint64_t resets;
+    uint64_t busy_ns;               /* Emulated device time consumed */
+} chipset_emu_stats_t;
+
+/* API Functions */
+
+/**
+ * chipset_emu_enable - Install the emulator as the bridge backend
+ * @config: Emulator configuration, or NULL for defaults
+ * 
+ * Devices registered with the bridge from now on (i.e. drivers loaded
+ * afterwards) are served by the model matching their chipset type and
+ * device ID, or by a generic model. The same configuration always
+ * produces the same register values, memory contents and timings.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_emu_enable(const chipset_emu_config_t *config);
+
+/**
+ * chipset_emu_disable - Restore the simulated bridge backend
+ * 
+ * Devices already attached keep their models until they are unregistered.
+ */
+void chipset_emu_disable(void);
+
+/**
+ * chipset_emu_get_stats - Get statistics for an emulated device
+ * @driver: Loaded driver
+ * @stats: Output statistics
+ * 
+ * The model is the one attached to @driver's bridge device, so functions
+ * sharing a device ID (e.g. two ports of one root complex) each report
+ * their own counts.
+ * 
+ * Returns: 0 on success, negative if @driver has no emulated device
+ */
+int chipset_emu_get_stats(const chipset_driver_t *driver, chipset_emu_stats_t *stats);
+
+#endif /* CHIPSET_EMU_H */
@@ -0,0 +1,532 @@
+/*
+ * ParrotWinKernel - Chipset Hotplug
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Hotplug Implementation
+ * 
+ * One thread reads uevents and patches the topology; a second thread
+ * performs the (slower) driver loads and unloads in event order.
+ */
+
+#define _GNU_SOURCE                     /* struct ucred */
+#include "chipset_hotplug.h"
+#include "pci_topology.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+#define HOTPLUG_MSG_SIZE        8192
+
+/* Pending load/unload */
+typedef struct hotplug_job {
+    bool add;
+    pci_function_t function;
+    uint64_t received_ns;
+    struct hotplug_job *next;
+} hotplug_job_t;
+
+/* Outcome of a job */
+typedef enum {
+    JOB_IGNORED,
+    JOB_DONE,
+    JOB_FAILED
+} job_result_t;
+
+/* Global hotplug state */
+static struct {
+    bool running;
+    int event_fd;
+    bool netlink;               /* event_fd is the kernel uevent socket */
+    int wake_fd;
+    pthread_t event_thread;
+    pthread_t load_thread;
+    
+    /* Job queue (event thread -> load thread) */
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    hotplug_job_t *head;
+    hotplug_job_t *tail;
+    
+    /* Drivers owned by hotplug (load thread only) */
+    chipset_driver_t **devices;
+    uint32_t count;
+    uint32_t capacity;
+    
+    bool auto_load;
+    chipset_hotplug_fn callback;
+    void *user_data;
+    chipset_hotplug_stats_t stats;
+} g_hotplug = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER,
+    .event_fd = -1,
+    .wake_fd = -1
+};
+
+/* Helper: monotonic time */
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Helper: open the kernel uevent socket */
+static int open_uevent_socket(void) {
+    int fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+    if (fd < 0) {
+        return -1;
+    }
+    
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = 1;         /* Kernel events */
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    
+    /* Sender credentials ride along with each message */
+    int on = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_PASSCRED, &on, sizeof(on)) != 0) {
+        close(fd);
+        return -1;
+    }
+    
+    return fd;
+}
+
+/* Helper: receive one uevent; -1 on error or if it did not come from
+ * the kernel. Any local process may send to the uevent group, so only
+ * messages from port 0 with root credentials are trusted. */
+static ssize_t recv_uevent(char *msg, size_t size) {
+    if (!g_hotplug.netlink) {
+        return recv(g_hotplug.event_fd, msg, size, 0);
+    }
+    
+    struct sockaddr_nl addr;
+    char control[CMSG_SPACE(sizeof(struct ucred))];
+    struct iovec iov = {.iov_base = msg, .iov_len = size};
+    struct msghdr hdr = {
+        .msg_name = &addr,
+        .msg_namelen = sizeof(addr),
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+        .msg_control = control,
+        .msg_controllen = sizeof(control)
+    };
+    
+    ssize_t len = recvmsg(g_hotplug.event_fd, &hdr, 0);
+    if (len <= 0) {
+        return -1;
+    }
+    
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr);
+    if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_CREDENTIALS) {
+        return -1;
+    }
+    struct ucred cred;
+    memcpy(&cred, CMSG_DATA(cmsg), sizeof(cred));
+    if (cred.uid != 0 || hdr.msg_namelen != sizeof(addr) || addr.nl_pid != 0) {
+        return -1;
+    }
+    
+    return len;
+}
+
+/* Helper: parse one PCI uevent; false if not a PCI add/remove */
+static bool parse_uevent(const char *msg, size_t len, bool *add, pci_function_t *fn) {
+    bool pci = false;
+    bool have_action = false;
+    
+    memset(fn, 0, sizeof(*fn));
+    
+    /* First string is "<action>@<devpath>", then KEY=value strings */
+    const char *devpath = memchr(msg, '@', strnlen(msg, len));
+    if (devpath) {
+        pci_topology_parent(devpath + 1, fn->parent);
+    }
+    for (size_t pos = strnlen(msg, len) + 1; pos < len; pos += strnlen(msg + pos, len - pos) + 1) {
+        const char *field = msg + pos;
+        
+        if (strcmp(field, "SUBSYSTEM=pci") == 0) {
+            pci = true;
+        } else if (strncmp(field, "ACTION=", 7) == 0) {
+            have_action = strcmp(field + 7, "add") == 0 || strcmp(field + 7, "remove") == 0;
+            *add = strcmp(field + 7, "add") == 0;
+        } else if (strncmp(field, "PCI_SLOT_NAME=", 14) == 0) {
+            snprintf(fn->address, sizeof(fn->address), "%s", field + 14);
+        } else if (strncmp(field, "PCI_ID=", 7) == 0) {
+            sscanf(field + 7, "%x:%x", &fn->vendor_id, &fn->device_id);
+        } else if (strncmp(field, "PCI_SUBSYS_ID=", 14) == 0) {
+            sscanf(field + 14, "%x:%x", &fn->subsys_vendor_id, &fn->subsys_device_id);
+        } else if (strncmp(field, "PCI_CLASS=", 10) == 0) {
+            sscanf(field + 10, "%x", &fn->class_code);
+        }
+    }
+    
+    return pci && have_action && fn->address[0] != '\0';
+}
+
+/* Event thread: uevents -> topology patch -> job */
+static void* event_thread_func(void *arg) {
+    (void)arg;
+    char msg[HOTPLUG_MSG_SIZE];
+    
+    while (__atomic_load_n(&g_hotplug.running, __ATOMIC_ACQUIRE)) {
+        struct pollfd fds[2] = {
+            {.fd = g_hotplug.event_fd, .events = POLLIN},
+            {.fd = g_hotplug.wake_fd, .events = POLLIN}
+        };
+        if (poll(fds, 2, -1) < 0 || (fds[1].revents & POLLIN)) {
+            continue;
+        }
+        if (fds[0].revents & (POLLHUP | POLLERR)) {
+            break;
+        }
+        
+        ssize_t len = recv_uevent(msg, sizeof(msg) - 1);
+        if (len <= 0) {
+            continue;
+        }
+        msg[len] = '\0';
+        uint64_t received = now_ns();
+        
+        bool add = false;
+        pci_function_t fn;
+        if (!parse_uevent(msg, (size_t)len, &add, &fn)) {
+            continue;
+        }
+        
+        /* The topology is current as soon as the event is seen */
+        if (add) {
+            pci_topology_read_locality(&fn);
+            pci_topology_add(&fn);
+        } else {
+            /* The unload needs the IDs, which remove events may omit */
+            if (fn.vendor_id == 0) {
+                const pci_topology_t *topology = pci_topology_get();
+                const pci_function_t *known = topology ?
+                    pci_topology_find(topology, fn.address) : NULL;
+                if (known) {
+                    fn.vendor_id = known->vendor_id;
+                    fn.device_id = known->device_id;
+                }
+                pci_topology_put(topology);
+            }
+            pci_topology_remove(fn.address);
+        }
+        
+        hotplug_job_t *job = (hotplug_job_t*)malloc(sizeof(hotplug_job_t));
+        if (!job) {
+            continue;
+        }
+        job->add = add;
+        job->function = fn;
+        job->received_ns = received;
+        job->next = NULL;
+        
+        pthread_mutex_lock(&g_hotplug.lock);
+        g_hotplug.stats.events++;
+        if (g_hotplug.tail) {
+            g_hotplug.tail->next = job;
+        } else {
+            g_hotplug.head = job;
+        }
+        g_hotplug.tail = job;
+        pthread_cond_signal(&g_hotplug.cond);
+        pthread_mutex_unlock(&g_hotplug.lock);
+    }
+    
+    return NULL;
+}
+
+/* Helper: index of an owned driver by address, or count */
+static uint32_t find_device(const char *address) {
+    for (uint32_t i = 0; i < g_hotplug.count; i++) {
+        if (strcmp(g_hotplug.devices[i]->pci_address, address) == 0) {
+            return i;
+        }
+    }
+    return g_hotplug.count;
+}
+
+/* Helper: handle an add event (load thread) */
+static job_result_t handle_add(const pci_function_t *fn) {
+    if (find_device(fn->address) < g_hotplug.count) {
+        return JOB_IGNORED;
+    }
+    
+    chipset_driver_t *driver = (chipset_driver_t*)malloc(sizeof(chipset_driver_t));
+    if (!driver) {
+        return JOB_FAILED;
+    }
+    if (chipset_identify(fn->vendor_id, fn->device_id, fn->address, driver) != CHIPSET_SUCCESS) {
+        free(driver);
+        return JOB_IGNORED;
+    }
+    
+    if (g_hotplug.count == g_hotplug.capacity) {
+        uint32_t capacity = g_hotplug.capacity ? g_hotplug.capacity * 2 : 16;
+        chipset_driver_t **grown = (chipset_driver_t**)realloc(g_hotplug.devices,
+                                                               capacity * sizeof(*grown));
+        if (!grown) {
+            free(driver);
+            return JOB_FAILED;
+        }
+        g_hotplug.devices = grown;
+        g_hotplug.capacity = capacity;
+    }
+    
+    /* Only a device that loaded is owned; a later add event retries it */
+    if (g_hotplug.auto_load && chipset_load_driver(driver) != CHIPSET_SUCCESS) {
+        fprintf(stderr, "[CHIPSET] Hotplug load failed for %s\n", driver->name);
+        free(driver);
+        return JOB_FAILED;
+    }
+    g_hotplug.devices[g_hotplug.count++] = driver;
+    
+    printf("[CHIPSET] Hotplug add: %s at %s\n", driver->name, driver->pci_address);
+    
+    if (g_hotplug.callback) {
+        g_hotplug.callback(driver, true, g_hotplug.user_data);
+    }
+    
+    return JOB_DONE;
+}
+
+/* Helper: handle a remove event (load thread) */
+static job_result_t handle_remove(const pci_function_t *fn) {
+    uint32_t i = find_device(fn->address);
+    if (i == g_hotplug.count) {
+        /* Loaded before hotplug started: unload through a copy of its record */
+        chipset_driver_t record;
+        if (chipset_find_driver(fn->vendor_id, fn->device_id, fn->address,
+                                &record) != CHIPSET_SUCCESS) {
+            return JOB_IGNORED;
+        }
+        
+        printf("[CHIPSET] Hotplug remove: %s at %s\n", record.name, record.pci_address);
+        
+        if (g_hotplug.callback) {
+            g_hotplug.callback(&record, false, g_hotplug.user_data);
+        }
+        chipset_unload_driver(&record);
+        
+        return JOB_DONE;
+    }
+    
+    chipset_driver_t *driver = g_hotplug.devices[i];
+    g_hotplug.devices[i] = g_hotplug.devices[--g_hotplug.count];
+    
+    printf("[CHIPSET] Hotplug remove: %s at %s\n", driver->name, driver->pci_address);
+    
+    if (g_hotplug.callback) {
+        g_hotplug.callback(driver, false, g_hotplug.user_data);
+    }
+    chipset_unload_driver(driver);
+    free(driver);
+    
+    return JOB_DONE;
+}
+
+/* Load thread: performs loads/unloads in event order */
+static void* load_thread_func(void *arg) {
+    (void)arg;
+    
+    pthread_mutex_lock(&g_hotplug.lock);
+    for (;;) {
+        while (g_hotplug.running && !g_hotplug.head) {
+            pthread_cond_wait(&g_hotplug.cond, &g_hotplug.lock);
+        }
+        if (!g_hotplug.head) {
+            break;
+        }
+        
+        hotplug_job_t *job = g_hotplug.head;
+        g_hotplug.head = job->next;
+        if (!g_hotplug.head) {
+            g_hotplug.tail = NULL;
+        }
+        pthread_mutex_unlock(&g_hotplug.lock);
+        
+        job_result_t result = job->add ? handle_add(&job->function)
+                                       : handle_remove(&job->function);
+        uint64_t reaction_us = (now_ns() - job->received_ns) / 1000;
+        
+        pthread_mutex_lock(&g_hotplug.lock);
+        if (result == JOB_IGNORED) {
+            g_hotplug.stats.ignored++;
+        } else if (result == JOB_FAILED) {
+            g_hotplug.stats.failed++;
+        } else if (job->add) {
+            g_hotplug.stats.added++;
+        } else {
+            g_hotplug.stats.removed++;
+        }
+        if (result == JOB_DONE) {
+            g_hotplug.stats.last_reaction_us = reaction_us;
+            if (reaction_us > g_hotplug.stats.max_reaction_us) {
+                g_hotplug.stats.max_reaction_us = reaction_us;
+            }
+        }
+        g_hotplug.stats.devices = g_hotplug.count;
+        free(job);
+    }
+    pthread_mutex_unlock(&g_hotplug.lock);
+    
+    return NULL;
+}
+
+/* Start hotplug */
+int chipset_hotplug_start(int event_fd, bool auto_load,
+                          chipset_hotplug_fn callback, void *user_data) {
+    if (g_hotplug.running) {
+        return CHIPSET_SUCCESS;
+    }
+    
+    g_hotplug.netlink = event_fd < 0;
+    if (event_fd < 0) {
+        event_fd = open_uevent_socket();
+        if (event_fd < 0) {
+            fprintf(stderr, "[CHIPSET] Cannot open uevent socket\n");
+            return CHIPSET_ERR_IO_ERROR;
+        }
+    }
+    
+    g_hotplug.wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (g_hotplug.wake_fd < 0) {
+        close(event_fd);
+        return CHIPSET_ERR_IO_ERROR;
+    }
+    
+    g_hotplug.event_fd = event_fd;
+    g_hotplug.auto_load = auto_load;
+    g_hotplug.callback = callback;
+    g_hotplug.user_data = user_data;
+    memset(&g_hotplug.stats, 0, sizeof(g_hotplug.stats));
+    g_hotplug.running = true;
+    
+    if (pthread_create(&g_hotplug.load_thread, NULL, load_thread_func, NULL) != 0) {
+        g_hotplug.running = false;
+        close(g_hotplug.wake_fd);
+        close(event_fd);
+        g_hotplug.wake_fd = -1;
+        g_hotplug.event_fd = -1;
+        return CHIPSET_ERR_NO_MEMORY;
+    }
+    if (pthread_create(&g_hotplug.event_thread, NULL, event_thread_func, NULL) != 0) {
+        pthread_mutex_lock(&g_hotplug.lock);
+        g_hotplug.running = false;
+        pthread_cond_signal(&g_hotplug.cond);
+        pthread_mutex_unlock(&g_hotplug.lock);
+        pthread_join(g_hotplug.load_thread, NULL);
+        close(g_hotplug.wake_fd);
+        close(event_fd);
+        g_hotplug.wake_fd = -1;
+        g_hotplug.event_fd = -1;
+        return CHIPSET_ERR_NO_MEMORY;
+    }
+    
+    printf("[CHIPSET] Hotplug detection started\n");
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Stop hotplug */
+void chipset_hotplug_stop(void) {
+    if (!g_hotplug.running) {
+        return;
+    }
+    
+    /* Stop reading events, then let the load thread drain its queue */
+    __atomic_store_n(&g_hotplug.running, false, __ATOMIC_RELEASE);
+    uint64_t one = 1;
+    if (write(g_hotplug.wake_fd, &one, sizeof(one)) < 0) {
+        perror("[CHIPSET] hotplug wake");
+    }
+    pthread_join(g_hotplug.event_thread, NULL);
+    
+    pthread_mutex_lock(&g_hotplug.lock);
+    pthread_cond_signal(&g_hotplug.cond);
+    pthread_mutex_unlock(&g_hotplug.lock);
+    pthread_join(g_hotplug.load_thread, NULL);
+    
+    for (uint32_t i = 0; i < g_hotplug.count; i++) {
+        chipset_unload_driver(g_hotplug.devices[i]);
+        free(g_hotplug.devices[i]);
+    }
+    free(g_hotplug.devices);
+    g_hotplug.devices = NULL;
+    g_hotplug.count = 0;
+    g_hotplug.capacity = 0;
+    g_hotplug.stats.devices = 0;
+    
+    close(g_hotplug.event_fd);
+    close(g_hotplug.wake_fd);
+    g_hotplug.event_fd = -1;
+    g_hotplug.wake_fd = -1;
+    
+    printf("[CHIPSET] Hotplug detection stopped\n");
+}
+
+/* Get hotplug statistics */
+int chipset_hotplug_get_stats(chipset_hotplug_stats_t *stats) {
+    if (!stats) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    pthread_mutex_lock(&g_hotplug.lock);
+    *stats = g_hotplug.stats;
+    pthread_mutex_unlock(&g_hotplug.lock);
+    
+    return CHIPSET_SUCCESS;
+}
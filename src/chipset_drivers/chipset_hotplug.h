@@ -0,0 +1,112 @@
+/*
+ * ParrotWinKernel - Chipset Hotplug
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Hotplug
+ * 
+ * Incremental detection driven by kernel uevents. Each PCI add/remove
+ * event patches the cached topology and loads or unloads one driver on a
+ * background thread, instead of rescanning everything.
+ */
+
+#ifndef CHIPSET_HOTPLUG_H
+#define CHIPSET_HOTPLUG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "chipset_driver.h"
+
+/* Called on the hotplug thread after a driver was added (and loaded, if
+ * auto-load is on) or before its record is freed on removal. Removing a
+ * driver loaded before hotplug started passes its canonical record. */
+typedef void (*chipset_hotplug_fn)(chipset_driver_t *driver, bool added, void *user_data);
+
+/* Hotplug statistics */
+typedef struct {
+    uint64_t events;            /* PCI uevents received */
+    uint64_t added;
+    uint64_t removed;
+    uint64_t ignored;           /* Unknown chipsets, duplicates, other actions */
+    uint64_t failed;            /* Adds whose driver did not load */
+    uint32_t devices;           /* Drivers currently owned by hotplug */
+    uint64_t last_reaction_us;  /* Event received to load/unload done */
+    uint64_t max_reaction_us;
+} chipset_hotplug_stats_t;
+
+/* API Functions */
+
+/**
+ * chipset_hotplug_start - Start incremental detection
+ * @event_fd: Source of uevent datagrams, or -1 to open the kernel's
+ *            NETLINK_KOBJECT_UEVENT socket. Tests may pass one end of an
+ *            AF_UNIX SOCK_SEQPACKET pair and replay synthetic events in
+ *            the kernel format ("add@<devpath>\0KEY=value\0..."). The
+ *            descriptor is closed by chipset_hotplug_stop().
+ * @auto_load: Load drivers for added chipsets and unload removed ones
+ * @callback: Notified of each added/removed chipset (may be NULL)
+ * @user_data: Passed to @callback
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_hotplug_start(int event_fd, bool auto_load,
+                          chipset_hotplug_fn callback, void *user_data);
+
+/**
+ * chipset_hotplug_stop - Stop incremental detection
+ * 
+ * Unloads and frees the drivers added by hotplug. Call before
+ * chipset_shutdown().
+ */
+void chipset_hotplug_stop(void);
+
+/**
+ * chipset_hotplug_get_stats - Get hotplug statistics
+ * @stats: Output statistics
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_hotplug_get_stats(chipset_hotplug_stats_t *stats);
+
+#endif /* CHIPSET_HOTPLUG_H */
@@ -0,0 +1,215 @@
+/*
+ * ParrotWinKernel - Chipset Driver Image Cache Implementation
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Driver Image Cache Implementation
+ * 
+ * Open and fstat identify the file; only a miss maps it. A hit needs
+ * size, mtime and ctime to agree as well: mtime can be set back by
+ * hand, ctime cannot. Entries are chained in a small hash table on
+ * (device, inode) and removed when their last reference goes.
+ */
+
+#include "chipset_image.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define IMAGE_BUCKETS           64      /* Power of two */
+
+/* Cached image */
+struct chipset_image {
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    struct timespec mtime;
+    struct timespec ctime;      /* Also moves when mtime is set back */
+    void *map;                  /* NULL for an empty file */
+    uint32_t refs;              /* Under g_image.lock */
+    struct chipset_image *next;
+};
+
+/* Global cache state */
+static struct {
+    pthread_mutex_t lock;
+    chipset_image_t *buckets[IMAGE_BUCKETS];
+    chipset_image_stats_t stats;
+} g_image = {
+    .lock = PTHREAD_MUTEX_INITIALIZER
+};
+
+/* Helper: bucket for a file identity */
+static inline uint32_t image_bucket(dev_t dev, ino_t ino) {
+    uint64_t h = ((uint64_t)dev * 0x9E3779B97F4A7C15ULL) ^ (uint64_t)ino;
+    h ^= h >> 29;
+    return (uint32_t)h & (IMAGE_BUCKETS - 1);
+}
+
+/* Helper: same file, unchanged since it was mapped */
+static inline bool image_matches(const chipset_image_t *image, const struct stat *st) {
+    return image->dev == st->st_dev && image->ino == st->st_ino &&
+           image->size == st->st_size &&
+           image->mtime.tv_sec == st->st_mtim.tv_sec &&
+           image->mtime.tv_nsec == st->st_mtim.tv_nsec &&
+           image->ctime.tv_sec == st->st_ctim.tv_sec &&
+           image->ctime.tv_nsec == st->st_ctim.tv_nsec;
+}
+
+/* Acquire an image */
+chipset_image_t* chipset_image_acquire(const char *path) {
+    if (!path) {
+        return NULL;
+    }
+    
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return NULL;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return NULL;
+    }
+    
+    uint32_t bucket = image_bucket(st.st_dev, st.st_ino);
+    
+    pthread_mutex_lock(&g_image.lock);
+    for (chipset_image_t *image = g_image.buckets[bucket]; image; image = image->next) {
+        if (image_matches(image, &st)) {
+            image->refs++;
+            g_image.stats.references++;
+            g_image.stats.hits++;
+            pthread_mutex_unlock(&g_image.lock);
+            close(fd);
+            return image;
+        }
+    }
+    
+    /* Mapped under the lock so concurrent loads of one file map it once */
+    chipset_image_t *image = (chipset_image_t*)calloc(1, sizeof(chipset_image_t));
+    void *map = NULL;
+    if (image && st.st_size > 0) {
+        map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (!image || map == MAP_FAILED) {
+        pthread_mutex_unlock(&g_image.lock);
+        free(image);
+        return NULL;
+    }
+    
+    image->dev = st.st_dev;
+    image->ino = st.st_ino;
+    image->size = st.st_size;
+    image->mtime = st.st_mtim;
+    image->ctime = st.st_ctim;
+    image->map = map;
+    image->refs = 1;
+    image->next = g_image.buckets[bucket];
+    g_image.buckets[bucket] = image;
+    
+    g_image.stats.images++;
+    g_image.stats.references++;
+    g_image.stats.mapped_bytes += (uint64_t)st.st_size;
+    g_image.stats.misses++;
+    pthread_mutex_unlock(&g_image.lock);
+    
+    printf("[CHIPSET] Mapped driver image %s (%lld bytes)\n", path, (long long)st.st_size);
+    
+    return image;
+}
+
+/* Release an image */
+void chipset_image_release(chipset_image_t *image) {
+    if (!image) {
+        return;
+    }
+    
+    pthread_mutex_lock(&g_image.lock);
+    g_image.stats.references--;
+    if (--image->refs > 0) {
+        pthread_mutex_unlock(&g_image.lock);
+        return;
+    }
+    
+    chipset_image_t **pp = &g_image.buckets[image_bucket(image->dev, image->ino)];
+    while (*pp != image) {
+        pp = &(*pp)->next;
+    }
+    *pp = image->next;
+    g_image.stats.images--;
+    g_image.stats.mapped_bytes -= (uint64_t)image->size;
+    pthread_mutex_unlock(&g_image.lock);
+    
+    if (image->map) {
+        munmap(image->map, (size_t)image->size);
+    }
+    free(image);
+}
+
+/* Get image contents */
+const void* chipset_image_data(const chipset_image_t *image, size_t *size) {
+    if (size) {
+        *size = image ? (size_t)image->size : 0;
+    }
+    return image ? image->map : NULL;
+}
+
+/* Get cache statistics */
+void chipset_image_get_stats(chipset_image_stats_t *stats) {
+    if (!stats) {
+        return;
+    }
+    
+    pthread_mutex_lock(&g_image.lock);
+    *stats = g_image.stats;
+    pthread_mutex_unlock(&g_image.lock);
+}
@@ -0,0 +1,113 @@
+/*
+ * ParrotWinKernel - Chipset Driver Image Cache
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Driver Image Cache
+ * 
+ * Driver images keyed by file identity (device, inode, size, and mtime
+ * and ctime to the nanosecond) and mapped read-only once, however many
+ * device functions use them. Devices keep only their own state; memory
+ * and load time follow the number of distinct driver files.
+ */
+
+#ifndef CHIPSET_IMAGE_H
+#define CHIPSET_IMAGE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Shared, read-only driver image (private to the cache) */
+typedef struct chipset_image chipset_image_t;
+
+/* Cache statistics */
+typedef struct {
+    uint32_t images;                /* Distinct images mapped */
+    uint32_t references;            /* Users of those images */
+    uint64_t mapped_bytes;
+    uint64_t hits;                  /* Acquires served by an existing mapping */
+    uint64_t misses;                /* Acquires that mapped a file */
+} chipset_image_stats_t;
+
+/* API Functions */
+
+/**
+ * chipset_image_acquire - Get the shared mapping of a driver image
+ * @path: Driver image file
+ * 
+ * Paths naming the same file (hard or symbolic links) share a mapping.
+ * A file replaced or modified since it was mapped gets a new mapping;
+ * users of the old one keep it until they release it. Replace driver
+ * files (write a new file, then rename it over the old one) rather than
+ * rewriting them in place: a private mapping still shows in-place writes
+ * to pages it has not copied, so existing users would see them.
+ * 
+ * Returns: Image reference on success, NULL if the file cannot be mapped
+ */
+chipset_image_t* chipset_image_acquire(const char *path);
+
+/**
+ * chipset_image_release - Drop a reference from chipset_image_acquire()
+ * @image: Image (may be NULL)
+ * 
+ * The mapping is removed with its last reference.
+ */
+void chipset_image_release(chipset_image_t *image);
+
+/**
+ * chipset_image_data - Get the contents of an image
+ * @image: Image
+ * @size: Output size in bytes (may be NULL)
+ * 
+ * Returns: Read-only contents, valid while the reference is held
+ * (NULL for an empty file)
+ */
+const void* chipset_image_data(const chipset_image_t *image, size_t *size);
+
+/**
+ * chipset_image_get_stats - Get cache statistics
+ * @stats: Output statistics
+ */
+void chipset_image_get_stats(chipset_image_stats_t *stats);
+
+#endif /* CHIPSET_IMAGE_H */
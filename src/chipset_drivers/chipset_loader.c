@@ -0,0 +1,546 @@
+/*
+ * ParrotWinKernel - Chipset Loader
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Loader Implementation
+ * 
+ * Builds the dependency graph once, then a small pool of threads (the
+ * caller included) takes drivers whose dependencies are all loaded.
+ */
+
+#include "chipset_loader.h"
+#include "pci_topology.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+
+#define LOADER_MAX_DEPTH        32      /* Bridges walked upstream per driver */
+
+/* "Load dependent after dependency" rule */
+typedef struct {
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t dep_vendor_id;
+    uint32_t dep_device_id;
+} load_dependency_t;
+
+/* Built-in platform dependencies */
+static const load_dependency_t builtin_dependencies[] = {
+    /* Graphics and PCIe ports are power-sequenced by the PMC */
+    {0x8086, 0x1904, 0x8086, 0x9D03},
+    {0x8086, 0x9D14, 0x8086, 0x9D03},
+    
+    /* IOMMU is programmed through the root complex */
+    {0x1022, 0x1481, 0x1022, 0x1480},
+};
+
+/* Declared dependencies */
+static struct {
+    pthread_mutex_t lock;
+    load_dependency_t *deps;
+    uint32_t count;
+    uint32_t capacity;
+} g_loader = {PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0};
+
+/* Dependency edge, dependency -> dependent */
+typedef struct {
+    uint32_t from;
+    uint32_t to;
+} load_edge_t;
+
+/* Shared state of one batch */
+typedef struct {
+    chipset_driver_t *drivers;
+    chipset_load_result_t *results;
+    uint32_t count;
+    
+    /* Dependents of node i are out[out_start[i] .. out_start[i + 1]) */
+    uint32_t *out_start;
+    uint32_t *out;
+    
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t *pending;          /* Unfinished dependencies */
+    bool *blocked;              /* A dependency failed */
+    uint32_t *ready;            /* FIFO; each node is pushed once */
+    uint32_t ready_head;
+    uint32_t ready_tail;
+    uint32_t remaining;         /* Schedulable nodes not yet finished */
+    uint64_t start_ns;
+} load_graph_t;
+
+/* Helper: Get current time in nanoseconds */
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Declare a dependency */
+int chipset_add_dependency(uint32_t vendor_id, uint32_t device_id,
+                           uint32_t dep_vendor_id, uint32_t dep_device_id) {
+    if (vendor_id == dep_vendor_id && device_id == dep_device_id) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    pthread_mutex_lock(&g_loader.lock);
+    if (g_loader.count == g_loader.capacity) {
+        uint32_t capacity = g_loader.capacity ? g_loader.capacity * 2 : 16;
+        load_dependency_t *grown = (load_dependency_t*)realloc(g_loader.deps,
+                                                               capacity * sizeof(*grown));
+        if (!grown) {
+            pthread_mutex_unlock(&g_loader.lock);
+            return CHIPSET_ERR_NO_MEMORY;
+        }
+        g_loader.deps = grown;
+        g_loader.capacity = capacity;
+    }
+    g_loader.deps[g_loader.count++] = (load_dependency_t){
+        vendor_id, device_id, dep_vendor_id, dep_device_id
+    };
+    pthread_mutex_unlock(&g_loader.lock);
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Batch being sorted, under g_loader.lock; qsort has no context argument */
+static const chipset_driver_t *g_sort_drivers;
+
+/* Helper: order node indices by PCI address */
+static int compare_address(const void *a, const void *b) {
+    return strcmp(g_sort_drivers[*(const uint32_t*)a].pci_address,
+                  g_sort_drivers[*(const uint32_t*)b].pci_address);
+}
+
+/* Helper: order node indices by vendor and device ID */
+static int compare_ids(const void *a, const void *b) {
+    const chipset_driver_t *x = &g_sort_drivers[*(const uint32_t*)a];
+    const chipset_driver_t *y = &g_sort_drivers[*(const uint32_t*)b];
+    if (x->vendor_id != y->vendor_id) {
+        return x->vendor_id < y->vendor_id ? -1 : 1;
+    }
+    if (x->device_id != y->device_id) {
+        return x->device_id < y->device_id ? -1 : 1;
+    }
+    return 0;
+}
+
+/* Helper: node with an address in the address-sorted index, or -1 */
+static int64_t find_address(const chipset_driver_t *drivers, const uint32_t *by_address,
+                            uint32_t count, const char *address) {
+    uint32_t lo = 0;
+    uint32_t hi = count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        int cmp = strcmp(drivers[by_address[mid]].pci_address, address);
+        if (cmp == 0) {
+            return by_address[mid];
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return -1;
+}
+
+/* Helper: first entry of the ID-sorted index at or after an ID pair */
+static uint32_t find_ids(const chipset_driver_t *drivers, const uint32_t *by_ids,
+                         uint32_t count, uint32_t vendor_id, uint32_t device_id) {
+    uint32_t lo = 0;
+    uint32_t hi = count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        const chipset_driver_t *d = &drivers[by_ids[mid]];
+        if (d->vendor_id < vendor_id ||
+            (d->vendor_id == vendor_id && d->device_id < device_id)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* Helper: append an edge */
+static bool add_edge(load_edge_t **edges, uint32_t *count, uint32_t *capacity,
+                     uint32_t from, uint32_t to) {
+    if (*count == *capacity) {
+        uint32_t grown_capacity = *capacity ? *capacity * 2 : 64;
+        load_edge_t *grown = (load_edge_t*)realloc(*edges, grown_capacity * sizeof(*grown));
+        if (!grown) {
+            return false;
+        }
+        *edges = grown;
+        *capacity = grown_capacity;
+    }
+    (*edges)[(*count)++] = (load_edge_t){from, to};
+    return true;
+}
+
+/* Helper: dependency edges from the bus hierarchy and declared rules */
+static load_edge_t* build_edges(const chipset_driver_t *drivers, uint32_t count,
+                                uint32_t *edge_count) {
+    load_edge_t *edges = NULL;
+    uint32_t capacity = 0;
+    *edge_count = 0;
+    
+    uint32_t *by_address = (uint32_t*)malloc(count * sizeof(uint32_t));
+    uint32_t *by_ids = (uint32_t*)malloc(count * sizeof(uint32_t));
+    if (!by_address || !by_ids) {
+        free(by_address);
+        free(by_ids);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        by_address[i] = i;
+        by_ids[i] = i;
+    }
+    pthread_mutex_lock(&g_loader.lock);
+    g_sort_drivers = drivers;
+    qsort(by_address, count, sizeof(uint32_t), compare_address);
+    qsort(by_ids, count, sizeof(uint32_t), compare_ids);
+    pthread_mutex_unlock(&g_loader.lock);
+    
+    bool ok = true;
+    
+    /* Nearest upstream bridge that is also in the batch */
+    const pci_topology_t *topology = pci_topology_get();
+    for (uint32_t i = 0; ok && topology && i < count; i++) {
+        const pci_function_t *fn = drivers[i].pci_address[0] ?
+            pci_topology_find(topology, drivers[i].pci_address) : NULL;
+        for (uint32_t depth = 0; fn && fn->parent[0] && depth < LOADER_MAX_DEPTH; depth++) {
+            int64_t parent = find_address(drivers, by_address, count, fn->parent);
+            if (parent >= 0 && (uint32_t)parent != i) {
+                ok = add_edge(&edges, edge_count, &capacity, (uint32_t)parent, i);
+                break;
+            }
+            fn = pci_topology_find(topology, fn->parent);
+        }
+    }
+    pci_topology_put(topology);
+    
+    /* Declared rules, built-in first */
+    pthread_mutex_lock(&g_loader.lock);
+    uint32_t builtin = sizeof(builtin_dependencies) / sizeof(builtin_dependencies[0]);
+    for (uint32_t r = 0; ok && r < builtin + g_loader.count; r++) {
+        const load_dependency_t *rule = r < builtin ? &builtin_dependencies[r] :
+                                                      &g_loader.deps[r - builtin];
+        uint32_t dep = find_ids(drivers, by_ids, count, rule->dep_vendor_id, rule->dep_device_id);
+        uint32_t dependent = find_ids(drivers, by_ids, count, rule->vendor_id, rule->device_id);
+        for (uint32_t a = dependent; ok && a < count; a++) {
+            const chipset_driver_t *to = &drivers[by_ids[a]];
+            if (to->vendor_id != rule->vendor_id || to->device_id != rule->device_id) {
+                break;
+            }
+            for (uint32_t b = dep; ok && b < count; b++) {
+                const chipset_driver_t *from = &drivers[by_ids[b]];
+                if (from->vendor_id != rule->dep_vendor_id ||
+                    from->device_id != rule->dep_device_id) {
+                    break;
+                }
+                ok = add_edge(&edges, edge_count, &capacity, by_ids[b], by_ids[a]);
+            }
+        }
+    }
+    pthread_mutex_unlock(&g_loader.lock);
+    
+    free(by_address);
+    free(by_ids);
+    
+    if (!ok) {
+        free(edges);
+        return NULL;
+    }
+    if (!edges) {
+        /* No dependencies; distinguish from allocation failure */
+        edges = (load_edge_t*)malloc(sizeof(load_edge_t));
+    }
+    return edges;
+}
+
+/* Helper: mark a node finished and release its dependents (lock held) */
+static void finish_node(load_graph_t *graph, uint32_t node, bool ok) {
+    for (uint32_t e = graph->out_start[node]; e < graph->out_start[node + 1]; e++) {
+        uint32_t next = graph->out[e];
+        if (!ok) {
+            graph->blocked[next] = true;
+        }
+        if (--graph->pending[next] == 0) {
+            graph->ready[graph->ready_tail++] = next;
+        }
+    }
+    graph->remaining--;
+    pthread_cond_broadcast(&graph->cond);
+}
+
+/* Loader thread: loads ready drivers until the batch is done */
+static void* load_thread_func(void *arg) {
+    load_graph_t *graph = (load_graph_t*)arg;
+    
+    pthread_mutex_lock(&graph->lock);
+    for (;;) {
+        while (graph->ready_head == graph->ready_tail && graph->remaining > 0) {
+            pthread_cond_wait(&graph->cond, &graph->lock);
+        }
+        if (graph->ready_head == graph->ready_tail) {
+            break;
+        }
+        uint32_t node = graph->ready[graph->ready_head++];
+        bool blocked = graph->blocked[node];
+        pthread_mutex_unlock(&graph->lock);
+        
+        chipset_load_result_t *result = &graph->results[node];
+        uint64_t start = now_ns();
+        result->start_us = (start - graph->start_ns) / 1000;
+        if (blocked) {
+            result->status = CHIPSET_ERR_LOAD_FAILED;
+            result->skipped = true;
+        } else {
+            result->status = chipset_load_driver(&graph->drivers[node]);
+            result->load_us = (now_ns() - start) / 1000;
+        }
+        
+        pthread_mutex_lock(&graph->lock);
+        finish_node(graph, node, result->status == CHIPSET_SUCCESS);
+    }
+    pthread_mutex_unlock(&graph->lock);
+    
+    return NULL;
+}
+
+/* Load a batch of drivers */
+int chipset_load_all(chipset_driver_t *drivers, uint32_t count, uint32_t threads,
+                     chipset_load_result_t *results, chipset_load_report_t *report) {
+    if (!drivers && count > 0) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    chipset_load_report_t summary;
+    memset(&summary, 0, sizeof(summary));
+    if (count == 0) {
+        if (report) {
+            *report = summary;
+        }
+        return CHIPSET_SUCCESS;
+    }
+    
+    uint64_t start = now_ns();
+    
+    uint32_t edge_count = 0;
+    load_edge_t *edges = build_edges(drivers, count, &edge_count);
+    
+    load_graph_t graph;
+    memset(&graph, 0, sizeof(graph));
+    graph.drivers = drivers;
+    graph.count = count;
+    graph.results = results ? results :
+                    (chipset_load_result_t*)malloc(count * sizeof(chipset_load_result_t));
+    graph.out_start = (uint32_t*)calloc(count + 1, sizeof(uint32_t));
+    graph.out = (uint32_t*)malloc((edge_count + 1) * sizeof(uint32_t));
+    graph.pending = (uint32_t*)calloc(count, sizeof(uint32_t));
+    graph.blocked = (bool*)calloc(count, sizeof(bool));
+    graph.ready = (uint32_t*)malloc(count * sizeof(uint32_t));
+    uint32_t *order = (uint32_t*)malloc(count * sizeof(uint32_t));
+    uint32_t *prev = (uint32_t*)malloc(count * sizeof(uint32_t));
+    uint64_t *chain_us = (uint64_t*)calloc(count, sizeof(uint64_t));
+    
+    int ret = CHIPSET_SUCCESS;
+    if (!edges || !graph.results || !graph.out_start || !graph.out || !graph.pending ||
+        !graph.blocked || !graph.ready || !order || !prev || !chain_us) {
+        ret = CHIPSET_ERR_NO_MEMORY;
+        goto out;
+    }
+    memset(graph.results, 0, count * sizeof(chipset_load_result_t));
+    
+    /* Adjacency in CSR form */
+    for (uint32_t e = 0; e < edge_count; e++) {
+        graph.out_start[edges[e].from + 1]++;
+        graph.pending[edges[e].to]++;
+        graph.results[edges[e].to].dependencies++;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        graph.out_start[i + 1] += graph.out_start[i];
+    }
+    memset(prev, 0, count * sizeof(uint32_t));
+    for (uint32_t e = 0; e < edge_count; e++) {
+        graph.out[graph.out_start[edges[e].from] + prev[edges[e].from]++] = edges[e].to;
+    }
+    
+    /* Topological order; nodes left over sit on or behind a cycle */
+    uint32_t ordered = 0;
+    memcpy(prev, graph.pending, count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < count; i++) {
+        if (prev[i] == 0) {
+            order[ordered++] = i;
+        }
+    }
+    for (uint32_t k = 0; k < ordered; k++) {
+        uint32_t node = order[k];
+        for (uint32_t e = graph.out_start[node]; e < graph.out_start[node + 1]; e++) {
+            if (--prev[graph.out[e]] == 0) {
+                order[ordered++] = graph.out[e];
+            }
+        }
+    }
+    if (ordered < count) {
+        fprintf(stderr, "[CHIPSET] Dependency cycle: skipping %u drivers\n", count - ordered);
+        for (uint32_t i = 0; i < count; i++) {
+            if (prev[i] != 0) {
+                graph.results[i].status = CHIPSET_ERR_LOAD_FAILED;
+                graph.results[i].skipped = true;
+            }
+        }
+    }
+    
+    /* Roots are ready */
+    for (uint32_t i = 0; i < count; i++) {
+        if (graph.pending[i] == 0) {
+            graph.ready[graph.ready_tail++] = i;
+        }
+    }
+    graph.remaining = ordered;
+    graph.start_ns = start;
+    pthread_mutex_init(&graph.lock, NULL);
+    pthread_cond_init(&graph.cond, NULL);
+    
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (uint32_t)cpus : 1;
+    }
+    if (threads > CHIPSET_LOAD_MAX_THREADS) {
+        threads = CHIPSET_LOAD_MAX_THREADS;
+    }
+    if (threads > count) {
+        threads = count;
+    }
+    
+    /* The caller is one of the loader threads */
+    pthread_t helpers[CHIPSET_LOAD_MAX_THREADS];
+    uint32_t started = 0;
+    while (started + 1 < threads &&
+           pthread_create(&helpers[started], NULL, load_thread_func, &graph) == 0) {
+        started++;
+    }
+    load_thread_func(&graph);
+    for (uint32_t t = 0; t < started; t++) {
+        pthread_join(helpers[t], NULL);
+    }
+    pthread_cond_destroy(&graph.cond);
+    pthread_mutex_destroy(&graph.lock);
+    
+    summary.threads = started + 1;
+    summary.edges = edge_count;
+    summary.total_us = (now_ns() - start) / 1000;
+    
+    /* Critical path: heaviest chain of measured load times */
+    uint32_t tail = ordered > 0 ? order[0] : UINT32_MAX;
+    for (uint32_t i = 0; i < count; i++) {
+        prev[i] = UINT32_MAX;
+    }
+    for (uint32_t k = 0; k < ordered; k++) {
+        uint32_t node = order[k];
+        chain_us[node] += graph.results[node].load_us;
+        for (uint32_t e = graph.out_start[node]; e < graph.out_start[node + 1]; e++) {
+            uint32_t next = graph.out[e];
+            if (prev[next] == UINT32_MAX || chain_us[node] > chain_us[next]) {
+                chain_us[next] = chain_us[node];
+                prev[next] = node;
+            }
+        }
+        if (chain_us[node] > chain_us[tail]) {
+            tail = node;
+        }
+    }
+    summary.critical_path_us = tail != UINT32_MAX ? chain_us[tail] : 0;
+    for (uint32_t node = tail; node != UINT32_MAX; node = prev[node]) {
+        graph.results[node].critical = true;
+        summary.critical_path_len++;
+    }
+    
+    for (uint32_t i = 0; i < count; i++) {
+        const chipset_load_result_t *result = &graph.results[i];
+        summary.serial_us += result->load_us;
+        if (result->skipped) {
+            summary.skipped++;
+        } else if (result->status == CHIPSET_SUCCESS) {
+            summary.loaded++;
+        } else {
+            summary.failed++;
+        }
+    }
+    
+    printf("[CHIPSET] Loaded %u/%u drivers in %lu us on %u threads "
+           "(critical path %lu us over %u drivers, serial %lu us)\n",
+           summary.loaded, count, (unsigned long)summary.total_us, summary.threads,
+           (unsigned long)summary.critical_path_us, summary.critical_path_len,
+           (unsigned long)summary.serial_us);
+    
+    if (summary.failed > 0 || summary.skipped > 0) {
+        ret = CHIPSET_ERR_LOAD_FAILED;
+    }
+    
+out:
+    if (report) {
+        *report = summary;
+    }
+    if (graph.results != results) {
+        free(graph.results);
+    }
+    free(graph.out_start);
+    free(graph.out);
+    free(graph.pending);
+    free(graph.blocked);
+    free(graph.ready);
+    free(order);
+    free(prev);
+    free(chain_us);
+    free(edges);
+    
+    return ret;
+}
@@ -0,0 +1,120 @@
+/*
+ * ParrotWinKernel - Chipset Loader
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Loader
+ * 
+ * Bulk driver loading at startup. Drivers are ordered by the PCI bus
+ * hierarchy and declared dependencies; independent drivers load in
+ * parallel, so startup takes about as long as the longest chain.
+ */
+
+#ifndef CHIPSET_LOADER_H
+#define CHIPSET_LOADER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "chipset_driver.h"
+
+#define CHIPSET_LOAD_MAX_THREADS    32
+
+/* Per-driver outcome of chipset_load_all() */
+typedef struct {
+    int status;                 /* CHIPSET_SUCCESS or a CHIPSET_ERR_* code */
+    bool skipped;               /* Not attempted: a dependency failed or cycled */
+    bool critical;              /* On the critical path */
+    uint32_t dependencies;      /* Direct dependencies within the batch */
+    uint64_t start_us;          /* Relative to the start of the batch */
+    uint64_t load_us;
+} chipset_load_result_t;
+
+/* Batch summary */
+typedef struct {
+    uint32_t loaded;
+    uint32_t failed;
+    uint32_t skipped;
+    uint32_t threads;
+    uint32_t edges;             /* Dependency edges in the graph */
+    uint64_t total_us;          /* Wall time of the batch */
+    uint64_t serial_us;         /* Sum of the individual load times */
+    uint64_t critical_path_us;  /* Longest chain of load times */
+    uint32_t critical_path_len;
+} chipset_load_report_t;
+
+/* API Functions */
+
+/**
+ * chipset_add_dependency - Declare that one chipset's driver needs another's
+ * @vendor_id: PCI vendor ID of the dependent chipset
+ * @device_id: PCI device ID of the dependent chipset
+ * @dep_vendor_id: PCI vendor ID of the chipset loaded first
+ * @dep_device_id: PCI device ID of the chipset loaded first
+ * 
+ * Applies to later chipset_load_all() batches that contain both chipsets.
+ * A few platform dependencies are built in.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_add_dependency(uint32_t vendor_id, uint32_t device_id,
+                           uint32_t dep_vendor_id, uint32_t dep_device_id);
+
+/**
+ * chipset_load_all - Load a batch of drivers in dependency order
+ * @drivers: Drivers to load (e.g. from chipset_detect())
+ * @count: Number of drivers
+ * @threads: Loader threads including the caller (0 = online CPUs)
+ * @results: Per-driver outcome, @count entries (may be NULL)
+ * @report: Batch summary (may be NULL)
+ * 
+ * A driver loads after its upstream bridge's driver (when both are in
+ * the batch) and after its declared dependencies. Drivers whose
+ * dependencies fail, or that sit on a dependency cycle, are skipped.
+ * 
+ * Returns: 0 if every driver loaded, CHIPSET_ERR_LOAD_FAILED if any
+ * failed or was skipped, other negative codes on error
+ */
+int chipset_load_all(chipset_driver_t *drivers, uint32_t count, uint32_t threads,
+                     chipset_load_result_t *results, chipset_load_report_t *report);
+
+#endif /* CHIPSET_LOADER_H */
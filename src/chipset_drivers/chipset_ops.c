@@ -0,0 +1,219 @@
+/*
+ * ParrotWinKernel - Chipset Operations
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Operations Implementation
+ * 
+ * Built-in vendor tables and the registry consulted when a driver loads.
+ * New vendors add a table here (or register one at runtime); the register
+ * and power paths in chipset_driver.c stay untouched.
+ */
+
+#include "chipset_ops.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define OPS_MAX_REGISTERED      32
+
+/* Intel/AMD platform devices */
+static const chipset_ops_t intel_ops = {
+    .name = "intel",
+    .caps = {
+        .supports_dma = true,
+        .supports_msi = true,
+        .supports_power_management = true,
+        .supports_pcie = true,
+        .max_transfer_size = 16 * 1024 * 1024,
+        .alignment_requirement = 4096
+    }
+};
+
+static const chipset_ops_t amd_ops = {
+    .name = "amd",
+    .caps = {
+        .supports_dma = true,
+        .supports_msi = true,
+        .supports_power_management = true,
+        .supports_pcie = true,
+        .max_transfer_size = 16 * 1024 * 1024,
+        .alignment_requirement = 4096
+    }
+};
+
+/* Helper: the PMC sequences every other device's power, so it stays in D0 */
+static int intel_pmc_set_power(chipset_driver_t *driver, uint32_t from, uint32_t to) {
+    (void)from;
+    if (to != 0) {
+        printf("[CHIPSET] %s stays in D0 (requested D%u)\n", driver->name, to);
+        return CHIPSET_ERR_NOT_SUPPORTED;
+    }
+    return CHIPSET_SUCCESS;
+}
+
+/* Intel PMC: posted register writes (generic path) with fixed power */
+static const chipset_ops_t intel_pmc_ops = {
+    .name = "intel-pmc",
+    .caps = {
+        .supports_dma = true,
+        .supports_msi = true,
+        .supports_power_management = true,
+        .supports_pcie = true,
+        .max_transfer_size = 16 * 1024 * 1024,
+        .alignment_requirement = 4096
+    },
+    .set_power = intel_pmc_set_power
+};
+
+static const chipset_ops_t nvidia_ops = {
+    .name = "nvidia",
+    .caps = {
+        .supports_dma = true,
+        .supports_msi = true,
+        .supports_power_management = true,
+        .supports_pcie = true,
+        .max_transfer_size = 64 * 1024 * 1024,
+        .alignment_requirement = 4096
+    }
+};
+
+/* Helper: MSI is advertised in config space but not wired on these SoCs */
+static void qualcomm_errata(const chipset_driver_t *driver, driver_capabilities_t *caps) {
+    (void)driver;
+    caps->supports_msi = false;
+}
+
+static const chipset_ops_t qualcomm_ops = {
+    .name = "qualcomm",
+    .caps = {
+        .supports_dma = true,
+        .supports_msi = false,
+        .supports_power_management = true,
+        .supports_pcie = false,
+        .max_transfer_size = 4 * 1024 * 1024,
+        .alignment_requirement = 64
+    },
+    .apply_errata = qualcomm_errata
+};
+
+/* Registry entry */
+typedef struct {
+    uint32_t vendor_id;
+    uint32_t device_id;
+    chipset_type_t type;
+    const chipset_ops_t *ops;
+} ops_entry_t;
+
+/* Built-in tables, most specific first */
+static const ops_entry_t builtin_ops[] = {
+    {0x8086, 0x9D03, CHIPSET_INTEL, &intel_pmc_ops},
+    {0, CHIPSET_OPS_ANY_DEVICE, CHIPSET_INTEL, &intel_ops},
+    {0, CHIPSET_OPS_ANY_DEVICE, CHIPSET_AMD, &amd_ops},
+    {0, CHIPSET_OPS_ANY_DEVICE, CHIPSET_NVIDIA, &nvidia_ops},
+    {0, CHIPSET_OPS_ANY_DEVICE, CHIPSET_QUALCOMM, &qualcomm_ops},
+};
+
+/* Runtime registrations */
+static struct {
+    pthread_mutex_t lock;
+    ops_entry_t entries[OPS_MAX_REGISTERED];
+    uint32_t count;
+} g_ops = {PTHREAD_MUTEX_INITIALIZER, {{0}}, 0};
+
+/* Helper: entry applies to a chipset */
+static inline bool entry_matches(const ops_entry_t *entry, uint32_t vendor_id,
+                                 uint32_t device_id, chipset_type_t type, bool device) {
+    if (device) {
+        return entry->device_id != CHIPSET_OPS_ANY_DEVICE &&
+               entry->vendor_id == vendor_id && entry->device_id == device_id;
+    }
+    return entry->device_id == CHIPSET_OPS_ANY_DEVICE && entry->type == type;
+}
+
+/* Register operations */
+int chipset_ops_register(uint32_t vendor_id, uint32_t device_id, chipset_type_t type,
+                         const chipset_ops_t *ops) {
+    if (!ops || type > CHIPSET_UNKNOWN) {
+        return CHIPSET_ERR_INVALID_ARG;
+    }
+    
+    pthread_mutex_lock(&g_ops.lock);
+    if (g_ops.count == OPS_MAX_REGISTERED) {
+        pthread_mutex_unlock(&g_ops.lock);
+        return CHIPSET_ERR_NO_MEMORY;
+    }
+    g_ops.entries[g_ops.count++] = (ops_entry_t){vendor_id, device_id, type, ops};
+    pthread_mutex_unlock(&g_ops.lock);
+    
+    printf("[CHIPSET] Registered %s operations for %s\n", ops->name ? ops->name : "custom",
+           device_id == CHIPSET_OPS_ANY_DEVICE ? "chipset type" : "device");
+    
+    return CHIPSET_SUCCESS;
+}
+
+/* Look up operations */
+const chipset_ops_t* chipset_ops_lookup(uint32_t vendor_id, uint32_t device_id,
+                                        chipset_type_t type) {
+    const chipset_ops_t *found = NULL;
+    
+    /* Device match, then type match; newest registration first */
+    pthread_mutex_lock(&g_ops.lock);
+    for (int pass = 0; pass < 2 && !found; pass++) {
+        bool device = pass == 0;
+        for (uint32_t i = g_ops.count; i > 0 && !found; i--) {
+            if (entry_matches(&g_ops.entries[i - 1], vendor_id, device_id, type, device)) {
+                found = g_ops.entries[i - 1].ops;
+            }
+        }
+        for (uint32_t i = 0; i < sizeof(builtin_ops) / sizeof(builtin_ops[0]) && !found; i++) {
+            if (entry_matches(&builtin_ops[i], vendor_id, device_id, type, device)) {
+                found = builtin_ops[i].ops;
+            }
+        }
+    }
+    pthread_mutex_unlock(&g_ops.lock);
+    
+    return found ? found : &chipset_generic_ops;
+}
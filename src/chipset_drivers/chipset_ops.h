@@ -0,0 +1,124 @@
+/*
+ * ParrotWinKernel - Chipset Operations
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Operations
+ * 
+ * Vendor-specific behaviour as tables of operations. A driver binds its
+ * table once at load; register access and power changes then make one
+ * indirect call instead of switching on the chipset type.
+ */
+
+#ifndef CHIPSET_OPS_H
+#define CHIPSET_OPS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "chipset_driver.h"
+
+#define CHIPSET_OPS_ANY_DEVICE  0xFFFFFFFF
+
+/* Operations table; NULL hooks fall back to chipset_generic_ops */
+typedef struct {
+    const char *name;
+    
+    /* Defaults before config space probing */
+    driver_capabilities_t caps;
+    
+    /* Batching hint: registers or segments per submission (0 = 64, max 64) */
+    uint32_t batch_size;
+    
+    /* Register access, after the shadow cache */
+    int (*read_register)(chipset_driver_t *driver, uint32_t offset, uint32_t *value,
+                         uint32_t timeout_us);
+    int (*write_register)(chipset_driver_t *driver, uint32_t offset, uint32_t value);
+    
+    /* Power sequencing between D-states */
+    int (*set_power)(chipset_driver_t *driver, uint32_t from, uint32_t to);
+    
+    /* Errata: adjust the probed capabilities at load (optional) */
+    void (*apply_errata)(const chipset_driver_t *driver, driver_capabilities_t *caps);
+} chipset_ops_t;
+
+/* Window-or-bridge register access and PCI PM spec power delays */
+extern const chipset_ops_t chipset_generic_ops;
+
+/* API Functions */
+
+/**
+ * chipset_ops_register - Provide operations for a chipset type or device
+ * @vendor_id: PCI vendor ID
+ * @device_id: PCI device ID, or CHIPSET_OPS_ANY_DEVICE for the whole type
+ * @type: Chipset type the table applies to
+ * @ops: Table, which must outlive every driver bound to it
+ * 
+ * Device-specific tables win over type tables; later registrations win
+ * over earlier ones and over the built-in tables. Applies to drivers
+ * loaded afterwards.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_ops_register(uint32_t vendor_id, uint32_t device_id, chipset_type_t type,
+                         const chipset_ops_t *ops);
+
+/**
+ * chipset_ops_lookup - Find the operations for a chipset
+ * @vendor_id: PCI vendor ID
+ * @device_id: PCI device ID
+ * @type: Chipset type
+ * 
+ * Returns: Most specific table (never NULL; hooks may be NULL)
+ */
+const chipset_ops_t* chipset_ops_lookup(uint32_t vendor_id, uint32_t device_id,
+                                        chipset_type_t type);
+
+/**
+ * chipset_get_ops - Get the operations bound to a loaded driver
+ * @driver: Loaded driver
+ * 
+ * Returns: Bound table with every hook resolved, NULL if not loaded
+ */
+const chipset_ops_t* chipset_get_ops(const chipset_driver_t *driver);
+
+#endif /* CHIPSET_OPS_H */
@@ -0,0 +1,320 @@
+/*
+ * ParrotWinKernel - Chipset Register Profiler
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Register Profiler Implementation
+ * 
+ * Keys are (offset << 1 | write). Each access adds to one counter and one
+ * latency sum per sketch row; the estimate is the row with the smallest
+ * count. Keys whose estimate beats the coldest hot slot take that slot
+ * with a compare-and-swap, so the table may briefly hold a duplicate or
+ * miss a race; both only blur the tail of the report.
+ */
+
+#include "chipset_profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#define PROFILE_DEPTH           4
+#define PROFILE_WIDTH           1024        /* Power of two */
+#define PROFILE_BAR_WIDTH       24
+
+/* Hot register slot; key is the sketch key plus one, 0 when empty */
+typedef struct {
+    uint64_t key;
+    uint64_t count;
+} profile_slot_t;
+
+struct chipset_profile {
+    uint64_t counts[PROFILE_DEPTH][PROFILE_WIDTH];
+    uint64_t latency_ns[PROFILE_DEPTH][PROFILE_WIDTH];
+    profile_slot_t hot[CHIPSET_PROFILE_TOP_K];
+    uint64_t threshold;         /* Coldest hot count once the table is full */
+    uint64_t reads;
+    uint64_t writes;
+};
+
+/* Per-row hash seeds */
+static const uint64_t row_seeds[PROFILE_DEPTH] = {
+    0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL,
+    0x165667B19E3779F9ULL, 0xD6E8FEB86659FD93ULL
+};
+
+/* Helper: sketch column of a key in a row */
+static uint32_t row_index(uint64_t key, int row) {
+    uint64_t h = key + row_seeds[row];
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return (uint32_t)(h & (PROFILE_WIDTH - 1));
+}
+
+/* Helper: estimated count and latency sum of a key */
+static uint64_t sketch_query(const chipset_profile_t *profile, uint64_t key, uint64_t *latency_ns) {
+    uint64_t count = UINT64_MAX;
+    for (int d = 0; d < PROFILE_DEPTH; d++) {
+        uint32_t i = row_index(key, d);
+        uint64_t c = __atomic_load_n(&profile->counts[d][i], __ATOMIC_RELAXED);
+        if (c < count) {
+            count = c;
+            *latency_ns = __atomic_load_n(&profile->latency_ns[d][i], __ATOMIC_RELAXED);
+        }
+    }
+    return count;
+}
+
+/* Helper: keep a key in the hot table if it outranks the coldest slot */
+static void track_hot(chipset_profile_t *profile, uint64_t tag, uint64_t count) {
+    uint32_t coldest = 0;
+    uint64_t coldest_key = 0;
+    uint64_t coldest_count = UINT64_MAX;
+    bool full = true;
+    
+    for (uint32_t i = 0; i < CHIPSET_PROFILE_TOP_K; i++) {
+        profile_slot_t *slot = &profile->hot[i];
+        uint64_t key = __atomic_load_n(&slot->key, __ATOMIC_ACQUIRE);
+        if (key == tag) {
+            /* Estimates only grow; a lost race leaves a slightly old count */
+            if (__atomic_load_n(&slot->count, __ATOMIC_RELAXED) < count) {
+                __atomic_store_n(&slot->count, count, __ATOMIC_RELAXED);
+            }
+            return;
+        }
+        uint64_t c = key ? __atomic_load_n(&slot->count, __ATOMIC_RELAXED) : 0;
+        full = full && key != 0;
+        if (c < coldest_count) {
+            coldest = i;
+            coldest_key = key;
+            coldest_count = c;
+        }
+    }
+    
+    if (count <= coldest_count) {
+        return;
+    }
+    
+    profile_slot_t *slot = &profile->hot[coldest];
+    if (__atomic_compare_exchange_n(&slot->key, &coldest_key, tag, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&slot->count, count, __ATOMIC_RELAXED);
+        if (full) {
+            __atomic_store_n(&profile->threshold, coldest_count, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/* Create profile */
+chipset_profile_t* chipset_profile_create(void) {
+    return (chipset_profile_t*)calloc(1, sizeof(chipset_profile_t));
+}
+
+/* Destroy profile */
+void chipset_profile_destroy(chipset_profile_t *profile) {
+    free(profile);
+}
+
+/* Reset profile */
+void chipset_profile_reset(chipset_profile_t *profile) {
+    for (int d = 0; d < PROFILE_DEPTH; d++) {
+        for (uint32_t i = 0; i < PROFILE_WIDTH; i++) {
+            __atomic_store_n(&profile->counts[d][i], 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&profile->latency_ns[d][i], 0, __ATOMIC_RELAXED);
+        }
+    }
+    for (uint32_t i = 0; i < CHIPSET_PROFILE_TOP_K; i++) {
+        __atomic_store_n(&profile->hot[i].key, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&profile->hot[i].count, 0, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&profile->threshold, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&profile->reads, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&profile->writes, 0, __ATOMIC_RELAXED);
+}
+
+/* Record access */
+void chipset_profile_record(chipset_profile_t *profile, uint32_t offset, bool write,
+                            uint64_t latency_ns) {
+    uint64_t key = ((uint64_t)offset << 1) | (write ? 1 : 0);
+    
+    __atomic_add_fetch(write ? &profile->writes : &profile->reads, 1, __ATOMIC_RELAXED);
+    
+    uint64_t count = UINT64_MAX;
+    for (int d = 0; d < PROFILE_DEPTH; d++) {
+        uint32_t i = row_index(key, d);
+        uint64_t c = __atomic_add_fetch(&profile->counts[d][i], 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&profile->latency_ns[d][i], latency_ns, __ATOMIC_RELAXED);
+        if (c < count) {
+            count = c;
+        }
+    }
+    
+    /* Cold registers never touch the hot table */
+    if (count > __atomic_load_n(&profile->threshold, __ATOMIC_RELAXED)) {
+        track_hot(profile, key + 1, count);
+    }
+}
+
+/* Helper: order entries by total accesses, hottest first */
+static int compare_heat(const void *a, const void *b) {
+    const chipset_profile_entry_t *ea = (const chipset_profile_entry_t*)a;
+    const chipset_profile_entry_t *eb = (const chipset_profile_entry_t*)b;
+    uint64_t ta = ea->reads + ea->writes;
+    uint64_t tb = eb->reads + eb->writes;
+    if (ta != tb) {
+        return ta > tb ? -1 : 1;
+    }
+    return ea->offset < eb->offset ? -1 : ea->offset > eb->offset;
+}
+
+/* Helper: order entries by offset */
+static int compare_offset(const void *a, const void *b) {
+    uint32_t oa = ((const chipset_profile_entry_t*)a)->offset;
+    uint32_t ob = ((const chipset_profile_entry_t*)b)->offset;
+    return oa < ob ? -1 : oa > ob;
+}
+
+/* Hottest registers */
+uint32_t chipset_profile_top(chipset_profile_t *profile, chipset_profile_entry_t *entries,
+                             uint32_t max_entries) {
+    chipset_profile_entry_t hot[CHIPSET_PROFILE_TOP_K];
+    uint32_t count = 0;
+    
+    /* Reads and writes of one offset may hold two slots; report them once */
+    for (uint32_t i = 0; i < CHIPSET_PROFILE_TOP_K; i++) {
+        uint64_t tag = __atomic_load_n(&profile->hot[i].key, __ATOMIC_ACQUIRE);
+        if (tag == 0) {
+            continue;
+        }
+        uint32_t offset = (uint32_t)((tag - 1) >> 1);
+        bool seen = false;
+        for (uint32_t j = 0; j < count && !seen; j++) {
+            seen = hot[j].offset == offset;
+        }
+        if (seen) {
+            continue;
+        }
+        
+        chipset_profile_entry_t *e = &hot[count++];
+        uint64_t read_ns = 0;
+        uint64_t write_ns = 0;
+        e->offset = offset;
+        e->reads = sketch_query(profile, (uint64_t)offset << 1, &read_ns);
+        e->writes = sketch_query(profile, ((uint64_t)offset << 1) | 1, &write_ns);
+        e->read_avg_ns = e->reads ? read_ns / e->reads : 0;
+        e->write_avg_ns = e->writes ? write_ns / e->writes : 0;
+    }
+    
+    qsort(hot, count, sizeof(chipset_profile_entry_t), compare_heat);
+    if (count > max_entries) {
+        count = max_entries;
+    }
+    memcpy(entries, hot, count * sizeof(chipset_profile_entry_t));
+    
+    return count;
+}
+
+/* Helper: what a register's access mix suggests */
+static const char* access_hint(const chipset_profile_entry_t *e) {
+    if (e->reads >= 8 * e->writes) {
+        return "cache";         /* Read-mostly: shadow it */
+    }
+    if (e->writes >= 8 * e->reads) {
+        return "post";          /* Write-mostly: post or write back */
+    }
+    return "map";               /* Mixed and hot: direct window */
+}
+
+/* Helper: append to a report, counting what did not fit */
+static void append(char *buf, size_t size, size_t *len, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + (*len < size ? *len : size), *len < size ? size - *len : 0, fmt, args);
+    va_end(args);
+    if (n > 0) {
+        *len += (size_t)n;
+    }
+}
+
+/* Format heatmap */
+int chipset_profile_format(chipset_profile_t *profile, const char *title, char *buf, size_t size) {
+    static const char heat[] = " .:-=+*#%@";
+    chipset_profile_entry_t entries[CHIPSET_PROFILE_TOP_K];
+    uint32_t count = chipset_profile_top(profile, entries, CHIPSET_PROFILE_TOP_K);
+    
+    uint64_t hottest = count ? entries[0].reads + entries[0].writes : 0;
+    uint64_t reads = __atomic_load_n(&profile->reads, __ATOMIC_RELAXED);
+    uint64_t writes = __atomic_load_n(&profile->writes, __ATOMIC_RELAXED);
+    uint64_t total = reads + writes;
+    qsort(entries, count, sizeof(chipset_profile_entry_t), compare_offset);
+    
+    size_t len = 0;
+    append(buf, size, &len, "%s: %llu reads, %llu writes, %u hot registers\n", title,
+           (unsigned long long)reads, (unsigned long long)writes, count);
+    append(buf, size, &len, "  offset      reads     writes  rd ns  wr ns  share  heat\n");
+    
+    for (uint32_t i = 0; i < count; i++) {
+        const chipset_profile_entry_t *e = &entries[i];
+        uint64_t accesses = e->reads + e->writes;
+        
+        /* A concurrent reset can zero every count after the top query */
+        uint32_t width = hottest ? (uint32_t)(accesses * PROFILE_BAR_WIDTH / hottest) : 0;
+        uint64_t level = hottest ? accesses * (sizeof(heat) - 2) / hottest : 0;
+        
+        /* Every hot register stays visible */
+        width = width ? width : 1;
+        char glyph = heat[level ? level : 1];
+        char bar[PROFILE_BAR_WIDTH + 1];
+        memset(bar, glyph, width);
+        memset(bar + width, ' ', PROFILE_BAR_WIDTH - width);
+        bar[PROFILE_BAR_WIDTH] = '\0';
+        
+        append(buf, size, &len, "  0x%04x %10llu %10llu %6llu %6llu %5.1f%%  |%s| %s\n", e->offset,
+               (unsigned long long)e->reads, (unsigned long long)e->writes,
+               (unsigned long long)e->read_avg_ns, (unsigned long long)e->write_avg_ns,
+               total ? 100.0 * (double)accesses / (double)total : 0.0, bar, access_hint(e));
+    }
+    
+    return (int)len;
+}
@@ -0,0 +1,119 @@
+/*
+ * ParrotWinKernel - Chipset Register Profiler
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Register Profiler
+ * 
+ * Per-device register access counts and latencies in a count-min sketch,
+ * with a small table of the heaviest offsets. Fixed size whatever the
+ * register space; updates are atomic adds, so recording never blocks.
+ */
+
+#ifndef CHIPSET_PROFILE_H
+#define CHIPSET_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "chipset_driver.h"
+
+#define CHIPSET_PROFILE_TOP_K   32
+
+/* Sketch and top-K table (private to the profiler) */
+typedef struct chipset_profile chipset_profile_t;
+
+/**
+ * chipset_profile_create - Allocate an empty profile
+ * 
+ * Returns: Profile, or NULL if out of memory
+ */
+chipset_profile_t* chipset_profile_create(void);
+
+/**
+ * chipset_profile_destroy - Free a profile no thread records into
+ * @profile: Profile (may be NULL)
+ */
+void chipset_profile_destroy(chipset_profile_t *profile);
+
+/**
+ * chipset_profile_reset - Clear a profile
+ * @profile: Profile
+ * 
+ * Accesses recorded concurrently may survive partly.
+ */
+void chipset_profile_reset(chipset_profile_t *profile);
+
+/**
+ * chipset_profile_record - Record one register access
+ * @profile: Profile
+ * @offset: Register offset
+ * @write: Write rather than read
+ * @latency_ns: Time the access took
+ */
+void chipset_profile_record(chipset_profile_t *profile, uint32_t offset, bool write,
+                            uint64_t latency_ns);
+
+/**
+ * chipset_profile_top - Hottest registers, reads and writes combined
+ * @profile: Profile
+ * @entries: Output, hottest first
+ * @max_entries: Size of @entries (at most CHIPSET_PROFILE_TOP_K are kept)
+ * 
+ * Returns: Number of entries filled
+ */
+uint32_t chipset_profile_top(chipset_profile_t *profile, chipset_profile_entry_t *entries,
+                             uint32_t max_entries);
+
+/**
+ * chipset_profile_format - Format a heatmap report
+ * @profile: Profile
+ * @title: First line of the report
+ * @buf: Output text
+ * @size: Size of @buf
+ * 
+ * Returns: Length of the full report (as snprintf)
+ */
+int chipset_profile_format(chipset_profile_t *profile, const char *title, char *buf, size_t size);
+
+#endif /* CHIPSET_PROFILE_H */
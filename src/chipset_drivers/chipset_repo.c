@@ -0,0 +1,661 @@
+/*
+ * ParrotWinKernel - Chipset Driver Repository
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Driver Repository Implementation
+ * 
+ * File layout: header, rules sorted by (vendor << 16 | device) with 0xFFFF
+ * halves for wildcards and most specific first within a key, then a string
+ * table holding the directory and the image file names.
+ */
+
+#include "chipset_repo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+
+#define CHIPSET_REPO_MAGIC      "PWKDRVI1"
+#define CHIPSET_REPO_VERSION    1
+
+#define REPO_KEY_ANY            0xFFFFFFFF  /* Class and catch-all rules */
+#define REPO_ID_ANY             0xFFFF
+
+/* On-disk header */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+    uint32_t strings_size;
+    uint32_t dir;               /* String table offset of the scanned directory */
+    uint64_t dir_mtime_ns;      /* Directory modification time at scan */
+} repo_header_t;
+
+/* On-disk rule */
+typedef struct {
+    uint32_t key;               /* vendor << 16 | device */
+    uint32_t subsys_vendor;     /* CHIPSET_REPO_ANY for any */
+    uint32_t subsys_device;
+    uint32_t class_code;        /* Compared under class_mask; 0 mask for any */
+    uint32_t class_mask;
+    uint32_t specificity;       /* Higher wins within a key */
+    uint32_t name;              /* String table offset of the image file name */
+    uint32_t reserved;
+} repo_entry_t;
+
+/* Loaded index */
+static struct {
+    pthread_rwlock_t lock;
+    void *map;
+    size_t map_size;
+    const repo_entry_t *entries;
+    const char *strings;
+    const char *dir;
+    uint32_t count;
+} g_repo = {
+    .lock = PTHREAD_RWLOCK_INITIALIZER
+};
+
+/* Directory watcher */
+static struct {
+    bool running;
+    pthread_t thread;
+    int inotify_fd;
+    int wake_fd;                /* Stop requests */
+    char dir[256];
+    char index_path[256];
+} g_repo_watch = {false, 0, -1, -1, "", ""};
+
+/* Helper: append a string to the table */
+static int64_t add_string(char **strings, uint32_t *size, uint32_t *capacity, const char *s) {
+    size_t len = strlen(s) + 1;
+    while (*size + len > *capacity) {
+        uint32_t grown_capacity = *capacity ? *capacity * 2 : 4096;
+        char *grown = (char*)realloc(*strings, grown_capacity);
+        if (!grown) {
+            return -1;
+        }
+        *strings = grown;
+        *capacity = grown_capacity;
+    }
+    memcpy(*strings + *size, s, len);
+    *size += (uint32_t)len;
+    return *size - (int64_t)len;
+}
+
+/* Helper: directory modification time */
+static bool dir_mtime(const char *dir, uint64_t *mtime_ns) {
+    struct stat st;
+    if (stat(dir, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        return false;
+    }
+    *mtime_ns = (uint64_t)st.st_mtim.tv_sec * 1000000000ULL + (uint64_t)st.st_mtim.tv_nsec;
+    return true;
+}
+
+/* Helper: driver image file name */
+static bool is_image_name(const char *name) {
+    size_t len = strlen(name);
+    return len > 4 && strcasecmp(name + len - 4, ".sys") == 0;
+}
+
+/* Helper: parse <digits> hex digits, or "xxxx" as a wildcard */
+static const char* parse_field(const char *s, int digits, uint32_t *value) {
+    if (digits == 4 && strncasecmp(s, "xxxx", 4) == 0) {
+        *value = CHIPSET_REPO_ANY;
+        return s + 4;
+    }
+    
+    uint32_t v = 0;
+    for (int i = 0; i < digits; i++) {
+        if (!isxdigit((unsigned char)s[i])) {
+            return NULL;
+        }
+        v = (v << 4) | (uint32_t)(isdigit((unsigned char)s[i]) ? s[i] - '0' :
+                                  tolower((unsigned char)s[i]) - 'a' + 10);
+    }
+    *value = v;
+    return s + digits;
+}
+
+/* Helper: turn an image file name into a match rule */
+static bool parse_rule(const char *name, repo_entry_t *entry) {
+    memset(entry, 0, sizeof(*entry));
+    entry->subsys_vendor = CHIPSET_REPO_ANY;
+    entry->subsys_device = CHIPSET_REPO_ANY;
+    
+    if (strncasecmp(name, "class_", 6) == 0) {
+        /* Class and subclass, optionally prog-if */
+        uint32_t code;
+        const char *p = parse_field(name + 6, 4, &code);
+        if (!p || code == CHIPSET_REPO_ANY) {
+            return false;
+        }
+        entry->class_code = code << 8;
+        entry->class_mask = 0xFFFF00;
+        
+        uint32_t prog_if;
+        const char *q = parse_field(p, 2, &prog_if);
+        if (q) {
+            entry->class_code |= prog_if;
+            entry->class_mask = 0xFFFFFF;
+            p = q;
+        }
+        
+        entry->key = REPO_KEY_ANY;
+        entry->specificity = entry->class_mask == 0xFFFFFF ? 2 : 1;
+        return strcasecmp(p, ".sys") == 0;
+    }
+    
+    uint32_t vendor;
+    uint32_t device;
+    const char *p = parse_field(name, 4, &vendor);
+    if (!p || *p != '_' || !(p = parse_field(p + 1, 4, &device))) {
+        return false;
+    }
+    
+    /* A device ID means nothing without its vendor */
+    if (vendor == CHIPSET_REPO_ANY && device != CHIPSET_REPO_ANY) {
+        return false;
+    }
+    
+    if (*p == '_') {
+        p = parse_field(p + 1, 4, &entry->subsys_vendor);
+        if (!p || *p != '_' || !(p = parse_field(p + 1, 4, &entry->subsys_device))) {
+            return false;
+        }
+    }
+    if (strcasecmp(p, ".sys") != 0) {
+        return false;
+    }
+    
+    entry->key = vendor == CHIPSET_REPO_ANY ? REPO_KEY_ANY :
+                 (vendor << 16) | (device == CHIPSET_REPO_ANY ? REPO_ID_ANY : device);
+    entry->specificity = (entry->subsys_vendor != CHIPSET_REPO_ANY ? 2 : 0) +
+                         (entry->subsys_device != CHIPSET_REPO_ANY ? 1 : 0);
+    return true;
+}
+
+/* Helper: order rules by key, most specific first, then by name */
+static int compare_entries(const void *a, const void *b) {
+    const repo_entry_t *ea = (const repo_entry_t*)a;
+    const repo_entry_t *eb = (const repo_entry_t*)b;
+    if (ea->key != eb->key) {
+        return ea->key < eb->key ? -1 : 1;
+    }
+    if (ea->specificity != eb->specificity) {
+        return ea->specificity > eb->specificity ? -1 : 1;
+    }
+    return ea->name < eb->name ? -1 : ea->name > eb->name;
+}
+
+/* Helper: order file names */
+static int compare_names(const void *a, const void *b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+/* Helper: rules that match exactly the same devices */
+static bool same_rule(const repo_entry_t *a, const repo_entry_t *b) {
+    return a->key == b->key &&
+           a->subsys_vendor == b->subsys_vendor &&
+           a->subsys_device == b->subsys_device &&
+           a->class_code == b->class_code &&
+           a->class_mask == b->class_mask;
+}
+
+/* Helper: list image file names in sorted order */
+static char** scan_names(const char *dir, uint32_t *count) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        return NULL;
+    }
+    
+    char **names = NULL;
+    uint32_t capacity = 0;
+    *count = 0;
+    
+    bool failed = false;
+    struct dirent *de;
+    while (!failed && (de = readdir(d)) != NULL) {
+        if (!is_image_name(de->d_name)) {
+            continue;
+        }
+        if (*count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            char **grown = (char**)realloc(names, capacity * sizeof(char*));
+            if (!grown) {
+                failed = true;
+                break;
+            }
+            names = grown;
+        }
+        names[*count] = strdup(de->d_name);
+        failed = !names[*count];
+        *count += !failed;
+    }
+    closedir(d);
+    
+    if (failed) {
+        for (uint32_t i = 0; i < *count; i++) {
+            free(names[i]);
+        }
+        free(names);
+        return NULL;
+    }
+    
+    /* An empty directory still gives a valid, empty list */
+    if (!names) {
+        names = (char**)malloc(sizeof(char*));
+    }
+    
+    /* Alphabetical, so name offsets break ties deterministically */
+    if (names) {
+        qsort(names, *count, sizeof(char*), compare_names);
+    }
+    return names;
+}
+
+/* Build index */
+int chipset_repo_build(const char *dir, const char *index_path) {
+    if (!dir || !index_path) {
+        return -1;
+    }
+    
+    /* Taken before the scan, so a change during it leaves the index stale */
+    uint64_t mtime_ns;
+    if (!dir_mtime(dir, &mtime_ns)) {
+        return -1;
+    }
+    
+    uint32_t name_count = 0;
+    char **names = scan_names(dir, &name_count);
+    if (!names) {
+        fprintf(stderr, "[CHIPSET] Cannot scan driver directory: %s\n", dir);
+        return -1;
+    }
+    
+    repo_entry_t *entries = (repo_entry_t*)malloc((name_count ? name_count : 1) * sizeof(repo_entry_t));
+    char *strings = NULL;
+    uint32_t strings_size = 0;
+    uint32_t strings_capacity = 0;
+    int64_t dir_name = add_string(&strings, &strings_size, &strings_capacity, dir);
+    bool failed = !entries || dir_name < 0;
+    uint32_t count = 0;
+    
+    for (uint32_t i = 0; i < name_count; i++) {
+        if (!failed && parse_rule(names[i], &entries[count])) {
+            int64_t name = add_string(&strings, &strings_size, &strings_capacity, names[i]);
+            if (name < 0) {
+                failed = true;
+            } else {
+                entries[count++].name = (uint32_t)name;
+            }
+        }
+        free(names[i]);
+    }
+    free(names);
+    
+    if (failed) {
+        free(entries);
+        free(strings);
+        return -1;
+    }
+    
+    /* Sort and keep the first of any duplicate rules */
+    qsort(entries, count, sizeof(repo_entry_t), compare_entries);
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (unique == 0 || !same_rule(&entries[unique - 1], &entries[i])) {
+            entries[unique++] = entries[i];
+        }
+    }
+    
+    repo_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CHIPSET_REPO_MAGIC, sizeof(header.magic));
+    header.version = CHIPSET_REPO_VERSION;
+    header.count = unique;
+    header.strings_size = strings_size;
+    header.dir = (uint32_t)dir_name;
+    header.dir_mtime_ns = mtime_ns;
+    
+    char tmp[512];
+    snprintf(tmp, sizeof(tmp), "%s.%d", index_path, (int)getpid());
+    FILE *out = fopen(tmp, "wb");
+    bool ok = out &&
+              fwrite(&header, sizeof(header), 1, out) == 1 &&
+              fwrite(entries, sizeof(repo_entry_t), unique, out) == unique &&
+              fwrite(strings, 1, strings_size, out) == strings_size;
+    if (out && fclose(out) != 0) {
+        ok = false;
+    }
+    
+    free(entries);
+    free(strings);
+    
+    if (!ok || rename(tmp, index_path) != 0) {
+        unlink(tmp);
+        fprintf(stderr, "[CHIPSET] Cannot write driver index: %s\n", index_path);
+        return -1;
+    }
+    
+    printf("[CHIPSET] Indexed %u driver rules from %s\n", unique, dir);
+    
+    return (int)unique;
+}
+
+/* Helper: map an index; with @dir, only one built for that directory as it is now */
+static int load_index(const char *index_path, const char *dir) {
+    int fd = open(index_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(repo_header_t)) {
+        close(fd);
+        return -1;
+    }
+    
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return -1;
+    }
+    
+    /* Validate before publishing */
+    const repo_header_t *header = (const repo_header_t*)map;
+    uint64_t expected = sizeof(repo_header_t) + (uint64_t)header->count * sizeof(repo_entry_t) +
+                        header->strings_size;
+    const repo_entry_t *entries = (const repo_entry_t*)(header + 1);
+    const char *strings = (const char*)(entries + header->count);
+    bool valid = memcmp(header->magic, CHIPSET_REPO_MAGIC, sizeof(header->magic)) == 0 &&
+                 header->version == CHIPSET_REPO_VERSION &&
+                 expected == (uint64_t)st.st_size &&
+                 header->dir < header->strings_size &&
+                 strings[header->strings_size - 1] == '\0';
+    for (uint32_t i = 0; valid && i < header->count; i++) {
+        valid = entries[i].name < header->strings_size &&
+                (i == 0 || entries[i - 1].key <= entries[i].key);
+    }
+    
+    if (!valid) {
+        fprintf(stderr, "[CHIPSET] Invalid driver index: %s\n", index_path);
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+    
+    uint64_t mtime_ns;
+    if (dir && (strcmp(strings + header->dir, dir) != 0 ||
+                !dir_mtime(dir, &mtime_ns) || mtime_ns != header->dir_mtime_ns)) {
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+    
+    pthread_rwlock_wrlock(&g_repo.lock);
+    void *old_map = g_repo.map;
+    size_t old_size = g_repo.map_size;
+    g_repo.map = map;
+    g_repo.map_size = (size_t)st.st_size;
+    g_repo.entries = entries;
+    g_repo.strings = strings;
+    g_repo.dir = strings + header->dir;
+    g_repo.count = header->count;
+    pthread_rwlock_unlock(&g_repo.lock);
+    
+    if (old_map) {
+        munmap(old_map, old_size);
+    }
+    
+    return 0;
+}
+
+/* Directory watcher thread: rebuild when images come or go */
+static void* repo_watch_func(void *arg) {
+    (void)arg;
+    
+    while (g_repo_watch.running) {
+        struct pollfd fds[2] = {
+            {.fd = g_repo_watch.inotify_fd, .events = POLLIN},
+            {.fd = g_repo_watch.wake_fd, .events = POLLIN}
+        };
+        if (poll(fds, 2, -1) < 0) {
+            continue;
+        }
+        if (fds[1].revents & POLLIN) {
+            break;
+        }
+        
+        /* One rebuild per batch of events, e.g. a package unpacking many files */
+        bool rebuild = false;
+        char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+        ssize_t len;
+        while ((len = read(g_repo_watch.inotify_fd, buf, sizeof(buf))) > 0) {
+            for (ssize_t off = 0; off < len; ) {
+                const struct inotify_event *ev = (const struct inotify_event*)(buf + off);
+                if (ev->len > 0 && is_image_name(ev->name)) {
+                    rebuild = true;
+                }
+                off += sizeof(struct inotify_event) + ev->len;
+            }
+        }
+        
+        if (rebuild && chipset_repo_build(g_repo_watch.dir, g_repo_watch.index_path) >= 0) {
+            load_index(g_repo_watch.index_path, NULL);
+        }
+    }
+    
+    return NULL;
+}
+
+/* Helper: stop the directory watcher */
+static void stop_repo_watch(void) {
+    if (!g_repo_watch.running) {
+        return;
+    }
+    
+    g_repo_watch.running = false;
+    uint64_t one = 1;
+    if (write(g_repo_watch.wake_fd, &one, sizeof(one)) < 0) {
+        /* Counter saturated; the watcher wakes anyway */
+    }
+    pthread_join(g_repo_watch.thread, NULL);
+    
+    close(g_repo_watch.inotify_fd);
+    close(g_repo_watch.wake_fd);
+    g_repo_watch.inotify_fd = -1;
+    g_repo_watch.wake_fd = -1;
+}
+
+/* Helper: start the directory watcher */
+static int start_repo_watch(const char *dir, const char *index_path) {
+    snprintf(g_repo_watch.dir, sizeof(g_repo_watch.dir), "%s", dir);
+    snprintf(g_repo_watch.index_path, sizeof(g_repo_watch.index_path), "%s", index_path);
+    
+    g_repo_watch.inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    g_repo_watch.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (g_repo_watch.inotify_fd < 0 || g_repo_watch.wake_fd < 0 ||
+        inotify_add_watch(g_repo_watch.inotify_fd, dir,
+                          IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE) < 0) {
+        fprintf(stderr, "[CHIPSET] Cannot watch driver directory %s\n", dir);
+        if (g_repo_watch.inotify_fd >= 0) close(g_repo_watch.inotify_fd);
+        if (g_repo_watch.wake_fd >= 0) close(g_repo_watch.wake_fd);
+        g_repo_watch.inotify_fd = -1;
+        g_repo_watch.wake_fd = -1;
+        return -1;
+    }
+    
+    g_repo_watch.running = true;
+    if (pthread_create(&g_repo_watch.thread, NULL, repo_watch_func, NULL) != 0) {
+        g_repo_watch.running = false;
+        close(g_repo_watch.inotify_fd);
+        close(g_repo_watch.wake_fd);
+        g_repo_watch.inotify_fd = -1;
+        g_repo_watch.wake_fd = -1;
+        return -1;
+    }
+    
+    return 0;
+}
+
+/* Open repository */
+int chipset_repo_open(const char *dir, const char *index_path, bool watch) {
+    if (!dir || !index_path || strlen(dir) >= sizeof(g_repo_watch.dir) ||
+        strlen(index_path) >= sizeof(g_repo_watch.index_path)) {
+        return -1;
+    }
+    
+    stop_repo_watch();
+    
+    /* Reuse the index unless the directory changed since it was built */
+    if (load_index(index_path, dir) != 0 &&
+        (chipset_repo_build(dir, index_path) < 0 || load_index(index_path, NULL) != 0)) {
+        return -1;
+    }
+    
+    /* Without the watcher the index still serves, it just goes stale */
+    if (watch) {
+        start_repo_watch(dir, index_path);
+    }
+    
+    printf("[CHIPSET] Driver repository %s: %u rules\n", dir, chipset_repo_count());
+    
+    return 0;
+}
+
+/* Close repository */
+void chipset_repo_close(void) {
+    stop_repo_watch();
+    
+    pthread_rwlock_wrlock(&g_repo.lock);
+    if (g_repo.map) {
+        munmap(g_repo.map, g_repo.map_size);
+    }
+    g_repo.map = NULL;
+    g_repo.map_size = 0;
+    g_repo.entries = NULL;
+    g_repo.strings = NULL;
+    g_repo.dir = NULL;
+    g_repo.count = 0;
+    pthread_rwlock_unlock(&g_repo.lock);
+}
+
+/* Helper: first rule for a key that matches the device (read lock held) */
+static const repo_entry_t* match_key(uint32_t key, uint32_t subsys_vendor, uint32_t subsys_device,
+                                     uint32_t class_code) {
+    uint32_t lo = 0;
+    uint32_t hi = g_repo.count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (g_repo.entries[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    
+    /* Most specific first, so the first match is the best */
+    for (uint32_t i = lo; i < g_repo.count && g_repo.entries[i].key == key; i++) {
+        const repo_entry_t *e = &g_repo.entries[i];
+        if ((e->subsys_vendor == CHIPSET_REPO_ANY || e->subsys_vendor == subsys_vendor) &&
+            (e->subsys_device == CHIPSET_REPO_ANY || e->subsys_device == subsys_device) &&
+            (e->class_mask == 0 ||
+             (class_code != CHIPSET_REPO_ANY && (class_code & e->class_mask) == e->class_code))) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/* Match device */
+int chipset_repo_match(uint32_t vendor_id, uint32_t device_id,
+                       uint32_t subsys_vendor_id, uint32_t subsys_device_id,
+                       uint32_t class_code, char *path, size_t size) {
+    int ret = 0;
+    
+    pthread_rwlock_rdlock(&g_repo.lock);
+    if (!g_repo.map) {
+        ret = -1;
+    } else {
+        uint32_t vendor_key = (vendor_id & 0xFFFF) << 16;
+        const repo_entry_t *e = NULL;
+        if ((device_id & 0xFFFF) != REPO_ID_ANY) {
+            e = match_key(vendor_key | (device_id & 0xFFFF), subsys_vendor_id, subsys_device_id,
+                          class_code);
+        }
+        if (!e) {
+            e = match_key(vendor_key | REPO_ID_ANY, subsys_vendor_id, subsys_device_id, class_code);
+        }
+        if (!e) {
+            e = match_key(REPO_KEY_ANY, subsys_vendor_id, subsys_device_id, class_code);
+        }
+        if (e) {
+            if (path && size > 0) {
+                snprintf(path, size, "%s/%s", g_repo.dir, g_repo.strings + e->name);
+            }
+            ret = 1;
+        }
+    }
+    pthread_rwlock_unlock(&g_repo.lock);
+    
+    return ret;
+}
+
+/* Index size */
+uint32_t chipset_repo_count(void) {
+    pthread_rwlock_rdlock(&g_repo.lock);
+    uint32_t count = g_repo.count;
+    pthread_rwlock_unlock(&g_repo.lock);
+    return count;
+}
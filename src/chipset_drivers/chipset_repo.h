@@ -0,0 +1,129 @@
+/*
+ * ParrotWinKernel - Chipset Driver Repository
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Driver Repository
+ * 
+ * Index of the Windows driver directory, built once by scanning it and
+ * kept as a compact mmapped file. Match rules come from the file names:
+ * 
+ *   VVVV_DDDD.sys              vendor and device
+ *   VVVV_DDDD_SSSS_TTTT.sys    plus subsystem vendor and device
+ *   VVVV_xxxx.sys              any device of a vendor
+ *   class_CCSS[PP].sys         any device of a class/subclass[/prog-if]
+ * 
+ * Any ID field may be "xxxx" except the vendor of a specific device. The
+ * most specific rule wins: exact ID, then vendor wildcard, then class.
+ * An inotify watcher rebuilds the index when the directory changes.
+ */
+
+#ifndef CHIPSET_REPO_H
+#define CHIPSET_REPO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define CHIPSET_REPO_DIR_DEFAULT    "/opt/windrvmgr/drivers"
+#define CHIPSET_REPO_INDEX_DEFAULT  "/opt/windrvmgr/drivers.idx"
+
+#define CHIPSET_REPO_ANY            0xFFFFFFFF  /* Wildcard or unknown ID */
+
+/* API Functions */
+
+/**
+ * chipset_repo_build - Scan a driver directory into an index file
+ * @dir: Directory of *.sys driver images
+ * @index_path: Output index (written atomically)
+ * 
+ * Files whose names do not follow the match grammar are skipped.
+ * 
+ * Returns: Number of rules indexed, negative on error
+ */
+int chipset_repo_build(const char *dir, const char *index_path);
+
+/**
+ * chipset_repo_open - Load the index for a directory, building it if stale
+ * @dir: Directory of *.sys driver images
+ * @index_path: Index file
+ * @watch: Rebuild the index whenever the directory changes
+ * 
+ * An existing index is reused if it was built for @dir at its current
+ * modification time. Replaces any index already open.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int chipset_repo_open(const char *dir, const char *index_path, bool watch);
+
+/**
+ * chipset_repo_close - Stop the watcher and unmap the index
+ */
+void chipset_repo_close(void);
+
+/**
+ * chipset_repo_match - Find the driver image for a device
+ * @vendor_id: PCI vendor ID
+ * @device_id: PCI device ID
+ * @subsys_vendor_id: Subsystem vendor ID, CHIPSET_REPO_ANY if unknown
+ * @subsys_device_id: Subsystem device ID, CHIPSET_REPO_ANY if unknown
+ * @class_code: Class, subclass and prog-if, CHIPSET_REPO_ANY if unknown
+ * @path: Output path of the best matching image
+ * @size: Size of @path
+ * 
+ * Unknown IDs only match rules that leave them as wildcards.
+ * 
+ * Returns: 1 if matched, 0 if no rule matches, negative if no index is open
+ */
+int chipset_repo_match(uint32_t vendor_id, uint32_t device_id,
+                       uint32_t subsys_vendor_id, uint32_t subsys_device_id,
+                       uint32_t class_code, char *path, size_t size);
+
+/**
+ * chipset_repo_count - Number of rules in the open index
+ * 
+ * Returns: Rule count, 0 if no index is open
+ */
+uint32_t chipset_repo_count(void);
+
+#endif /* CHIPSET_REPO_H */
@@ -0,0 +1,219 @@
+/*
+ * ParrotWinKernel - PCI Capabilities
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * PCI Capabilities Implementation
+ * 
+ * Walks the standard capability list of a config space image. Only the
+ * capabilities that affect driver tuning are decoded.
+ */
+
+#include "pci_caps.h"
+#include "pci_topology.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+/* Configuration header */
+#define PCI_COMMAND             0x04
+#define PCI_COMMAND_MASTER      0x0004
+#define PCI_STATUS              0x06
+#define PCI_STATUS_CAP_LIST     0x0010
+#define PCI_CLASS_PROG          0x09
+#define PCI_CAPABILITY_LIST     0x34
+#define PCI_HEADER_SIZE         64
+#define PCI_CONFIG_SIZE         256
+#define PCI_MAX_CAPS            48      /* Bounds a corrupt or looping list */
+
+/* Capability IDs */
+#define PCI_CAP_ID_PM           0x01
+#define PCI_CAP_ID_MSI          0x05
+#define PCI_CAP_ID_EXP          0x10
+#define PCI_CAP_ID_MSIX         0x11
+
+/* sysfs resource flags (IORESOURCE_*) */
+#define RESOURCE_IO             0x00000100
+#define RESOURCE_PREFETCH       0x00002000
+#define RESOURCE_MEM_64         0x00100000
+
+/* Helper: little-endian 16-bit config read */
+static inline uint16_t config_word(const uint8_t *config, size_t offset) {
+    return (uint16_t)(config[offset] | (config[offset + 1] << 8));
+}
+
+/* Helper: little-endian 32-bit config read */
+static inline uint32_t config_dword(const uint8_t *config, size_t offset) {
+    return (uint32_t)config_word(config, offset) |
+           ((uint32_t)config_word(config, offset + 2) << 16);
+}
+
+/* Helper: decode the PCI Express capability */
+static void parse_pcie(const uint8_t *config, size_t length, size_t pos, pci_caps_t *caps) {
+    if (pos + 0x14 > length) {
+        return;
+    }
+    
+    uint16_t flags = config_word(config, pos + 0x02);
+    uint32_t devcap = config_dword(config, pos + 0x04);
+    uint16_t devctl = config_word(config, pos + 0x08);
+    uint32_t lnkcap = config_dword(config, pos + 0x0C);
+    uint16_t lnksta = config_word(config, pos + 0x12);
+    
+    caps->pcie = true;
+    caps->pcie_version = flags & 0xF;
+    caps->pcie_port_type = (flags >> 4) & 0xF;
+    caps->max_payload_supported = 128u << (devcap & 0x7);
+    caps->max_payload = 128u << ((devctl >> 5) & 0x7);
+    caps->max_read_request = 128u << ((devctl >> 12) & 0x7);
+    caps->max_link_speed = lnkcap & 0xF;
+    caps->max_link_width = (lnkcap >> 4) & 0x3F;
+    caps->link_speed = lnksta & 0xF;
+    caps->link_width = (lnksta >> 4) & 0x3F;
+}
+
+/* Parse config space */
+int pci_caps_parse(const uint8_t *config, size_t length, pci_caps_t *caps) {
+    if (!config || !caps || length < PCI_HEADER_SIZE) {
+        return -1;
+    }
+    
+    memset(caps, 0, sizeof(*caps));
+    caps->bus_master = (config_word(config, PCI_COMMAND) & PCI_COMMAND_MASTER) != 0;
+    caps->class_code = config[PCI_CLASS_PROG] | (config[PCI_CLASS_PROG + 1] << 8) |
+                       ((uint32_t)config[PCI_CLASS_PROG + 2] << 16);
+    
+    /* The list lives past the header; unprivileged reads stop at 64 bytes */
+    if (length <= PCI_HEADER_SIZE) {
+        return 0;
+    }
+    caps->valid = true;
+    if (!(config_word(config, PCI_STATUS) & PCI_STATUS_CAP_LIST)) {
+        return 0;
+    }
+    
+    size_t pos = config[PCI_CAPABILITY_LIST] & ~3u;
+    for (uint32_t n = 0; pos >= PCI_HEADER_SIZE && pos + 4 <= length && n < PCI_MAX_CAPS; n++) {
+        uint8_t id = config[pos];
+        uint16_t ctrl = config_word(config, pos + 2);
+        
+        switch (id) {
+            case PCI_CAP_ID_PM:
+                caps->pm = true;
+                caps->pm_d1 = (ctrl & 0x0200) != 0;
+                caps->pm_d2 = (ctrl & 0x0400) != 0;
+                caps->pme_states = (uint8_t)(ctrl >> 11);
+                break;
+                
+            case PCI_CAP_ID_MSI:
+                caps->msi = true;
+                caps->msi_64bit = (ctrl & 0x0080) != 0;
+                caps->msi_vectors = 1u << ((ctrl >> 1) & 0x7);
+                break;
+                
+            case PCI_CAP_ID_EXP:
+                parse_pcie(config, length, pos, caps);
+                break;
+                
+            case PCI_CAP_ID_MSIX:
+                caps->msix = true;
+                caps->msix_vectors = (ctrl & 0x07FF) + 1u;
+                break;
+                
+            default:
+                break;
+        }
+        
+        pos = config[pos + 1] & ~3u;
+    }
+    
+    return 0;
+}
+
+/* Read capabilities from sysfs */
+int pci_caps_read(const char *address, pci_caps_t *caps) {
+    if (!address || !caps) {
+        return -1;
+    }
+    
+    uint8_t config[PCI_CONFIG_SIZE];
+    ssize_t length = pci_topology_read_attr(address, "config", config, sizeof(config));
+    if (length < 0 || pci_caps_parse(config, (size_t)length, caps) != 0) {
+        return -1;
+    }
+    
+    /* One "start end flags" line per resource; BARs come first */
+    char text[1024];
+    ssize_t n = pci_topology_read_attr(address, "resource", text, sizeof(text) - 1);
+    if (n > 0) {
+        text[n] = '\0';
+        char *save = NULL;
+        char *line = strtok_r(text, "\n", &save);
+        for (uint32_t bar = 0; line && bar < PCI_CAPS_BARS; bar++) {
+            uint64_t start = 0;
+            uint64_t end = 0;
+            uint64_t flags = 0;
+            if (sscanf(line, "%" SCNx64 " %" SCNx64 " %" SCNx64, &start, &end, &flags) == 3 &&
+                end > start) {
+                caps->bar_size[bar] = end - start + 1;
+                caps->bar_flags[bar] = ((flags & RESOURCE_IO) ? PCI_BAR_IO : 0) |
+                                       ((flags & RESOURCE_MEM_64) ? PCI_BAR_64BIT : 0) |
+                                       ((flags & RESOURCE_PREFETCH) ? PCI_BAR_PREFETCH : 0);
+            }
+            line = strtok_r(NULL, "\n", &save);
+        }
+    }
+    
+    return 0;
+}
+
+/* Link bandwidth */
+uint32_t pci_link_speed_mbps(uint8_t speed, uint8_t width) {
+    /* Per-lane MB/s: 8b/10b for Gen1-2, 128b/130b for Gen3-5, ~FLIT for Gen6 */
+    static const uint32_t lane_mbps[] = {0, 250, 500, 985, 1969, 3938, 7563};
+    if (speed >= sizeof(lane_mbps) / sizeof(lane_mbps[0])) {
+        return 0;
+    }
+    return lane_mbps[speed] * width;
+}
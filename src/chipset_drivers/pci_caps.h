@@ -0,0 +1,137 @@
+/*
+ * ParrotWinKernel - PCI Capabilities
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * PCI Capabilities
+ * 
+ * Parses a function's configuration space (capability list, PCIe link
+ * and payload settings) and BAR sizes, so drivers can be tuned to the
+ * device actually present rather than to its vendor.
+ */
+
+#ifndef PCI_CAPS_H
+#define PCI_CAPS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define PCI_CAPS_BARS           6
+
+/* BAR flags */
+#define PCI_BAR_IO              0x1     /* I/O port space */
+#define PCI_BAR_64BIT           0x2
+#define PCI_BAR_PREFETCH        0x4
+
+/* Capabilities of one function */
+typedef struct {
+    bool valid;                 /* Capability list was readable */
+    bool bus_master;            /* DMA enabled in the command register */
+    uint32_t class_code;        /* Base class, subclass, programming interface */
+    
+    /* Interrupts */
+    bool msi;
+    bool msi_64bit;
+    uint32_t msi_vectors;
+    bool msix;
+    uint32_t msix_vectors;
+    
+    /* Power management */
+    bool pm;
+    bool pm_d1;
+    bool pm_d2;
+    uint8_t pme_states;         /* D-states that can signal PME, bit n = Dn */
+    
+    /* PCI Express */
+    bool pcie;
+    uint8_t pcie_version;
+    uint8_t pcie_port_type;
+    uint32_t max_payload;       /* Bytes, as programmed */
+    uint32_t max_payload_supported;
+    uint32_t max_read_request;
+    uint8_t link_speed;         /* Negotiated generation (1 = 2.5 GT/s, 2 = 5 GT/s, ...) */
+    uint8_t link_width;         /* Negotiated lanes */
+    uint8_t max_link_speed;
+    uint8_t max_link_width;
+    
+    /* Base address registers */
+    uint64_t bar_size[PCI_CAPS_BARS];
+    uint32_t bar_flags[PCI_CAPS_BARS];
+} pci_caps_t;
+
+/* API Functions */
+
+/**
+ * pci_caps_parse - Parse a configuration space image
+ * @config: Configuration space bytes from offset 0
+ * @length: Bytes available (at least 64)
+ * @caps: Output capabilities (BAR sizes are left zero)
+ * 
+ * Returns: 0 on success, -1 if the header is too short
+ */
+int pci_caps_parse(const uint8_t *config, size_t length, pci_caps_t *caps);
+
+/**
+ * pci_caps_read - Discover a function's capabilities from sysfs
+ * @address: Domain:bus:device.function
+ * @caps: Output capabilities
+ * 
+ * Reads the function's config and resource attributes. Without
+ * privileges sysfs exposes only the 64-byte header, in which case
+ * @caps->valid is false but BAR sizes are still filled in.
+ * 
+ * Returns: 0 on success, -1 if the function cannot be read
+ */
+int pci_caps_read(const char *address, pci_caps_t *caps);
+
+/**
+ * pci_link_speed_mbps - Usable bandwidth of a PCIe link
+ * @speed: Link generation (1-6)
+ * @width: Lanes
+ * 
+ * Returns: Megabytes per second after line encoding, 0 if unknown
+ */
+uint32_t pci_link_speed_mbps(uint8_t speed, uint8_t width);
+
+#endif /* PCI_CAPS_H */
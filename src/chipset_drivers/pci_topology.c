@@ -0,0 +1,796 @@
+/*
+ * ParrotWinKernel - PCI Topology
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * PCI Topology Implementation
+ * 
+ * Each function is read with openat()/read() of its uevent file relative
+ * to one directory fd. Large topologies are split across a few threads.
+ */
+
+#include "pci_topology.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+/* Parallel scan tuning */
+#define PCI_PARALLEL_MIN        64      /* Functions before threads pay off */
+#define PCI_PER_THREAD_MIN      32
+#define PCI_SCAN_THREADS        8
+
+/* Persistent cache file format */
+#define PCI_CACHE_MAGIC         "PWKTOPO1"
+#define PCI_CACHE_VERSION       3
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+    uint64_t fingerprint;
+    char boot_id[48];
+    char root[256];
+} pci_cache_header_t;
+
+/* Global topology state */
+static struct {
+    pthread_mutex_t lock;
+    pci_topology_t *current;
+    uint64_t generation;
+    char root[256];
+    char cache_path[256];       /* Empty = no persistent cache */
+} g_topology = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .root = PCI_SYSFS_DEVICES,
+    .cache_path = PCI_TOPOLOGY_CACHE
+};
+
+/* Scan work shared by the scanner threads */
+typedef struct {
+    int root_fd;
+    char (*names)[16];
+    pci_function_t *functions;
+    bool *present;
+    uint32_t count;
+    uint32_t next;              /* Claimed atomically */
+} scan_work_t;
+
+/* Helper: monotonic time */
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Helper: read a small sysfs file relative to a directory fd */
+static ssize_t read_at(int dir_fd, const char *path, char *buf, size_t size) {
+    int fd = openat(dir_fd, path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    ssize_t n = read(fd, buf, size - 1);
+    close(fd);
+    if (n < 0) {
+        return -1;
+    }
+    buf[n] = '\0';
+    return n;
+}
+
+/* Helper: PCI address syntax, dddd:bb:dd.f */
+static bool is_pci_address(const char *s, size_t len) {
+    return len == 12 && s[4] == ':' && s[7] == ':' && s[10] == '.';
+}
+
+/* Upstream bridge from a device path */
+void pci_topology_parent(const char *devpath, char *parent) {
+    parent[0] = '\0';
+    
+    /* The component before the device itself, if it is a function too */
+    const char *end = strrchr(devpath, '/');
+    if (!end) {
+        return;
+    }
+    const char *start = end;
+    while (start > devpath && start[-1] != '/') {
+        start--;
+    }
+    if (is_pci_address(start, (size_t)(end - start))) {
+        memcpy(parent, start, (size_t)(end - start));
+        parent[end - start] = '\0';
+    }
+}
+
+/* Helper: NUMA node and local CPUs of a function */
+static void read_locality(int root_fd, const char *name, pci_function_t *fn) {
+    char path[64];
+    char buf[128];
+    
+    fn->numa_node = -1;
+    fn->local_cpulist[0] = '\0';
+    
+    snprintf(path, sizeof(path), "%s/numa_node", name);
+    if (read_at(root_fd, path, buf, sizeof(buf)) > 0 && sscanf(buf, "%d", &fn->numa_node) != 1) {
+        fn->numa_node = -1;
+    }
+    snprintf(path, sizeof(path), "%s/local_cpulist", name);
+    if (read_at(root_fd, path, buf, sizeof(buf)) > 0) {
+        /* A cut-off list would name the wrong CPUs; leave it unknown */
+        size_t len = strcspn(buf, "\n");
+        if (len < sizeof(fn->local_cpulist)) {
+            memcpy(fn->local_cpulist, buf, len);
+            fn->local_cpulist[len] = '\0';
+        }
+    }
+}
+
+/* Helper: read one function from its uevent file */
+static bool read_function(int root_fd, const char *name, pci_function_t *fn) {
+    char path[64];
+    char buf[512];
+    
+    memset(fn, 0, sizeof(*fn));
+    snprintf(fn->address, sizeof(fn->address), "%s", name);
+    read_locality(root_fd, name, fn);
+    
+    /* Device entries link into the bus hierarchy */
+    ssize_t link = readlinkat(root_fd, name, buf, sizeof(buf) - 1);
+    if (link > 0) {
+        buf[link] = '\0';
+        pci_topology_parent(buf, fn->parent);
+    }
+    
+    snprintf(path, sizeof(path), "%s/uevent", name);
+    if (read_at(root_fd, path, buf, sizeof(buf)) > 0) {
+        bool have_id = false;
+        char *save = NULL;
+        for (char *line = strtok_r(buf, "\n", &save); line; line = strtok_r(NULL, "\n", &save)) {
+            if (strncmp(line, "PCI_ID=", 7) == 0) {
+                have_id = sscanf(line + 7, "%x:%x", &fn->vendor_id, &fn->device_id) == 2;
+            } else if (strncmp(line, "PCI_SUBSYS_ID=", 14) == 0) {
+                sscanf(line + 14, "%x:%x", &fn->subsys_vendor_id, &fn->subsys_device_id);
+            } else if (strncmp(line, "PCI_CLASS=", 10) == 0) {
+                sscanf(line + 10, "%x", &fn->class_code);
+            }
+        }
+        if (have_id) {
+            return true;
+        }
+    }
+    
+    /* Fall back to the individual attribute files */
+    snprintf(path, sizeof(path), "%s/vendor", name);
+    if (read_at(root_fd, path, buf, sizeof(buf)) <= 0 ||
+        sscanf(buf, "%x", &fn->vendor_id) != 1) {
+        return false;
+    }
+    snprintf(path, sizeof(path), "%s/device", name);
+    if (read_at(root_fd, path, buf, sizeof(buf)) <= 0 ||
+        sscanf(buf, "%x", &fn->device_id) != 1) {
+        return false;
+    }
+    snprintf(path, sizeof(path), "%s/class", name);
+    if (read_at(root_fd, path, buf, sizeof(buf)) > 0) {
+        sscanf(buf, "%x", &fn->class_code);
+    }
+    
+    return true;
+}
+
+/* Scanner thread: claims functions until none are left */
+static void* scan_thread_func(void *arg) {
+    scan_work_t *work = (scan_work_t*)arg;
+    
+    for (;;) {
+        uint32_t i = __atomic_fetch_add(&work->next, 1, __ATOMIC_RELAXED);
+        if (i >= work->count) {
+            break;
+        }
+        work->present[i] = read_function(work->root_fd, work->names[i], &work->functions[i]);
+    }
+    
+    return NULL;
+}
+
+/* Helper: order by address */
+static int compare_names(const void *a, const void *b) {
+    return strcmp((const char*)a, (const char*)b);
+}
+
+/* Helper: sorted function names in the devices directory */
+static char (*list_names(int root_fd, uint32_t *count))[16] {
+    int dir_fd = dup(root_fd);
+    DIR *dir = dir_fd >= 0 ? fdopendir(dir_fd) : NULL;
+    if (!dir) {
+        if (dir_fd >= 0) {
+            close(dir_fd);
+        }
+        return NULL;
+    }
+    
+    uint32_t capacity = 64;
+    uint32_t n = 0;
+    char (*names)[16] = malloc(capacity * sizeof(*names));
+    struct dirent *entry;
+    while (names && (entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.' || strlen(entry->d_name) >= sizeof(names[0])) {
+            continue;
+        }
+        if (n == capacity) {
+            capacity *= 2;
+            char (*grown)[16] = realloc(names, capacity * sizeof(*names));
+            if (!grown) {
+                free(names);
+                names = NULL;
+                break;
+            }
+            names = grown;
+        }
+        memcpy(names[n++], entry->d_name, sizeof(names[0]));
+    }
+    closedir(dir);
+    
+    if (names) {
+        qsort(names, n, sizeof(names[0]), compare_names);
+        *count = n;
+    }
+    return names;
+}
+
+/* Helper: current boot ID, empty if unavailable */
+static void read_boot_id(char *boot_id, size_t size) {
+    if (read_at(AT_FDCWD, PCI_BOOT_ID, boot_id, size) <= 0) {
+        boot_id[0] = '\0';
+    }
+    boot_id[strcspn(boot_id, "\n")] = '\0';
+}
+
+/* Helper: FNV-1a over the boot ID and the sorted device list */
+static uint64_t fingerprint(const char (*names)[16], uint32_t count) {
+    char boot_id[48];
+    read_boot_id(boot_id, sizeof(boot_id));
+    
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char *c = boot_id; *c; c++) {
+        hash = (hash ^ (uint8_t)*c) * 0x100000001b3ULL;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        for (const char *c = names[i]; *c; c++) {
+            hash = (hash ^ (uint8_t)*c) * 0x100000001b3ULL;
+        }
+        hash = (hash ^ '/') * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/* Helper: enumerate the devices directory into a new snapshot */
+static pci_topology_t* scan_topology(const char *root) {
+    uint64_t start = now_ns();
+    
+    int root_fd = open(root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (root_fd < 0) {
+        fprintf(stderr, "[CHIPSET] Cannot access PCI devices\n");
+        return NULL;
+    }
+    
+    /* Collect names first so the work can be split */
+    uint32_t count = 0;
+    char (*names)[16] = list_names(root_fd, &count);
+    if (!names) {
+        close(root_fd);
+        return NULL;
+    }
+    
+    pci_topology_t *topology = calloc(1, sizeof(pci_topology_t) +
+                                         count * sizeof(pci_function_t));
+    bool *present = calloc(count ? count : 1, sizeof(bool));
+    if (!topology || !present) {
+        free(topology);
+        free(present);
+        free(names);
+        close(root_fd);
+        return NULL;
+    }
+    
+    scan_work_t work = {
+        .root_fd = root_fd,
+        .names = names,
+        .functions = topology->functions,
+        .present = present,
+        .count = count,
+        .next = 0
+    };
+    
+    /* Servers expose hundreds of functions; spread the syscalls */
+    uint32_t threads = 0;
+    if (count >= PCI_PARALLEL_MIN) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = count / PCI_PER_THREAD_MIN;
+        if (threads > PCI_SCAN_THREADS) threads = PCI_SCAN_THREADS;
+        if (cpus > 0 && threads > (uint32_t)cpus) threads = (uint32_t)cpus;
+        if (threads < 2) threads = 0;
+    }
+    
+    pthread_t helpers[PCI_SCAN_THREADS];
+    uint32_t started = 0;
+    for (uint32_t t = 1; t < threads; t++) {
+        if (pthread_create(&helpers[started], NULL, scan_thread_func, &work) == 0) {
+            started++;
+        }
+    }
+    scan_thread_func(&work);
+    for (uint32_t t = 0; t < started; t++) {
+        pthread_join(helpers[t], NULL);
+    }
+    
+    /* Compact away functions that vanished or could not be read */
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (present[i]) {
+            if (kept != i) {
+                topology->functions[kept] = topology->functions[i];
+            }
+            kept++;
+        }
+    }
+    topology->count = kept;
+    topology->fingerprint = fingerprint((const char (*)[16])names, count);
+    topology->refs = 1;
+    topology->scan_ns = now_ns() - start;
+    
+    free(present);
+    free(names);
+    close(root_fd);
+    
+    printf("[CHIPSET] Enumerated %u PCI functions in %lu us (%u threads)\n",
+           kept, (unsigned long)(topology->scan_ns / 1000), threads ? started + 1 : 1);
+    
+    return topology;
+}
+
+/* Helper: write the persistent cache atomically (lock held) */
+static void write_cache(const pci_topology_t *topology) {
+    if (g_topology.cache_path[0] == '\0') {
+        return;
+    }
+    
+    pci_cache_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PCI_CACHE_MAGIC, sizeof(header.magic));
+    header.version = PCI_CACHE_VERSION;
+    header.count = topology->count;
+    header.fingerprint = topology->fingerprint;
+    read_boot_id(header.boot_id, sizeof(header.boot_id));
+    snprintf(header.root, sizeof(header.root), "%s", g_topology.root);
+    
+    /* Best effort: create the cache directory on first use */
+    char dir[256];
+    snprintf(dir, sizeof(dir), "%s", g_topology.cache_path);
+    char *slash = strrchr(dir, '/');
+    if (slash && slash != dir) {
+        *slash = '\0';
+        mkdir(dir, 0755);
+    }
+    
+    char tmp[300];
+    snprintf(tmp, sizeof(tmp), "%s.%d", g_topology.cache_path, (int)getpid());
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    
+    size_t body = topology->count * sizeof(pci_function_t);
+    bool ok = write(fd, &header, sizeof(header)) == (ssize_t)sizeof(header) &&
+              write(fd, topology->functions, body) == (ssize_t)body;
+    close(fd);
+    
+    if (!ok || rename(tmp, g_topology.cache_path) != 0) {
+        unlink(tmp);
+    }
+}
+
+/* Helper: load the persistent cache if it was written this boot (lock held) */
+static pci_topology_t* load_cache(void) {
+    if (g_topology.cache_path[0] == '\0') {
+        return NULL;
+    }
+    
+    uint64_t start = now_ns();
+    int fd = open(g_topology.cache_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return NULL;
+    }
+    
+    pci_cache_header_t header;
+    char boot_id[48];
+    read_boot_id(boot_id, sizeof(boot_id));
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        read(fd, &header, sizeof(header)) != (ssize_t)sizeof(header) ||
+        memcmp(header.magic, PCI_CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != PCI_CACHE_VERSION ||
+        (uint64_t)st.st_size != sizeof(header) + (uint64_t)header.count * sizeof(pci_function_t) ||
+        boot_id[0] == '\0' ||
+        strncmp(header.boot_id, boot_id, sizeof(header.boot_id)) != 0 ||
+        strncmp(header.root, g_topology.root, sizeof(header.root)) != 0) {
+        close(fd);
+        return NULL;
+    }
+    
+    size_t body = header.count * sizeof(pci_function_t);
+    pci_topology_t *topology = calloc(1, sizeof(pci_topology_t) + body);
+    if (!topology || read(fd, topology->functions, body) != (ssize_t)body) {
+        free(topology);
+        close(fd);
+        return NULL;
+    }
+    close(fd);
+    
+    topology->count = header.count;
+    topology->fingerprint = header.fingerprint;
+    topology->from_cache = true;
+    topology->refs = 1;
+    topology->scan_ns = now_ns() - start;
+    
+    printf("[CHIPSET] Loaded %u PCI functions from cache in %lu us\n",
+           topology->count, (unsigned long)(topology->scan_ns / 1000));
+    
+    return topology;
+}
+
+/* Helper: replace the cached snapshot (lock held) */
+static void publish_topology(pci_topology_t *topology) {
+    topology->generation = ++g_topology.generation;
+    pci_topology_t *old = g_topology.current;
+    g_topology.current = topology;
+    pci_topology_put(old);
+    
+    /* Patched snapshots have no fingerprint; the next start rescans */
+    if (!topology->from_cache && !topology->incremental) {
+        write_cache(topology);
+    }
+}
+
+/* Background check of a snapshot loaded from the persistent cache */
+static void* verify_thread_func(void *arg) {
+    uint64_t generation = (uint64_t)(uintptr_t)arg;
+    char root[256];
+    uint64_t expected;
+    
+    pthread_mutex_lock(&g_topology.lock);
+    if (!g_topology.current || g_topology.current->generation != generation) {
+        pthread_mutex_unlock(&g_topology.lock);
+        return NULL;
+    }
+    memcpy(root, g_topology.root, sizeof(root));
+    expected = g_topology.current->fingerprint;
+    pthread_mutex_unlock(&g_topology.lock);
+    
+    /* Listing the directory is cheap next to reading every function */
+    int root_fd = open(root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    uint32_t count = 0;
+    char (*names)[16] = root_fd >= 0 ? list_names(root_fd, &count) : NULL;
+    if (root_fd >= 0) {
+        close(root_fd);
+    }
+    bool match = names && fingerprint((const char (*)[16])names, count) == expected;
+    free(names);
+    
+    if (match) {
+        printf("[CHIPSET] PCI topology cache verified\n");
+        return NULL;
+    }
+    
+    printf("[CHIPSET] PCI topology changed since cache was written, rescanning\n");
+    pci_topology_t *topology = scan_topology(root);
+    if (!topology) {
+        return NULL;
+    }
+    
+    /* Only replace the snapshot this thread was asked to verify */
+    pthread_mutex_lock(&g_topology.lock);
+    if (g_topology.current && g_topology.current->generation == generation &&
+        strcmp(g_topology.root, root) == 0) {
+        publish_topology(topology);
+        topology = NULL;
+    }
+    pthread_mutex_unlock(&g_topology.lock);
+    
+    pci_topology_put(topology);
+    return NULL;
+}
+
+/* Get topology */
+const pci_topology_t* pci_topology_get(void) {
+    pthread_mutex_lock(&g_topology.lock);
+    if (!g_topology.current) {
+        pci_topology_t *topology = load_cache();
+        bool verify = topology != NULL;
+        if (!topology) {
+            topology = scan_topology(g_topology.root);
+        }
+        if (topology) {
+            publish_topology(topology);
+        }
+        
+        pthread_t thread;
+        if (verify && pthread_create(&thread, NULL, verify_thread_func,
+                                     (void*)(uintptr_t)topology->generation) == 0) {
+            pthread_detach(thread);
+        }
+    }
+    pci_topology_t *topology = g_topology.current;
+    if (topology) {
+        __atomic_add_fetch(&topology->refs, 1, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&g_topology.lock);
+    
+    return topology;
+}
+
+/* Release topology */
+void pci_topology_put(const pci_topology_t *topology) {
+    pci_topology_t *t = (pci_topology_t*)topology;
+    if (t && __atomic_sub_fetch(&t->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(t);
+    }
+}
+
+/* Rescan topology */
+int pci_topology_rescan(void) {
+    pthread_mutex_lock(&g_topology.lock);
+    pci_topology_t *topology = scan_topology(g_topology.root);
+    if (topology) {
+        publish_topology(topology);
+    }
+    pthread_mutex_unlock(&g_topology.lock);
+    
+    return topology ? 0 : -1;
+}
+
+/* Helper: index of an address, or its insertion point */
+static uint32_t find_slot(const pci_topology_t *topology, const char *address, bool *found) {
+    uint32_t lo = 0;
+    uint32_t hi = topology->count;
+    *found = false;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        int cmp = strcmp(topology->functions[mid].address, address);
+        if (cmp == 0) {
+            *found = true;
+            return mid;
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* Helper: copy of a snapshot with one function inserted, replaced or removed */
+static pci_topology_t* patch_topology(const pci_topology_t *old, uint32_t slot, bool found,
+                                      const pci_function_t *function) {
+    uint32_t count = old->count;
+    if (function && !found) {
+        count++;
+    } else if (!function) {
+        count--;
+    }
+    
+    pci_topology_t *topology = calloc(1, sizeof(pci_topology_t) +
+                                         count * sizeof(pci_function_t));
+    if (!topology) {
+        return NULL;
+    }
+    
+    uint32_t tail = old->count - slot - (found ? 1 : 0);
+    memcpy(topology->functions, old->functions, slot * sizeof(pci_function_t));
+    if (function) {
+        topology->functions[slot] = *function;
+        memcpy(&topology->functions[slot + 1], &old->functions[old->count - tail],
+               tail * sizeof(pci_function_t));
+    } else {
+        memcpy(&topology->functions[slot], &old->functions[old->count - tail],
+               tail * sizeof(pci_function_t));
+    }
+    
+    topology->count = count;
+    topology->refs = 1;
+    topology->incremental = true;
+    return topology;
+}
+
+/* Add function */
+int pci_topology_add(const pci_function_t *function) {
+    if (!function) {
+        return -1;
+    }
+    
+    int ret = 0;
+    pthread_mutex_lock(&g_topology.lock);
+    if (g_topology.current) {
+        bool found;
+        uint32_t slot = find_slot(g_topology.current, function->address, &found);
+        pci_topology_t *topology = patch_topology(g_topology.current, slot, found, function);
+        if (topology) {
+            publish_topology(topology);
+        } else {
+            ret = -1;
+        }
+    }
+    pthread_mutex_unlock(&g_topology.lock);
+    
+    return ret;
+}
+
+/* Remove function */
+int pci_topology_remove(const char *address) {
+    if (!address) {
+        return -1;
+    }
+    
+    int ret = 0;
+    pthread_mutex_lock(&g_topology.lock);
+    if (g_topology.current) {
+        bool found;
+        uint32_t slot = find_slot(g_topology.current, address, &found);
+        if (found) {
+            pci_topology_t *topology = patch_topology(g_topology.current, slot, true, NULL);
+            if (topology) {
+                publish_topology(topology);
+            } else {
+                ret = -1;
+            }
+        }
+    }
+    pthread_mutex_unlock(&g_topology.lock);
+    
+    return ret;
+}
+
+/* Set sysfs root */
+void pci_topology_set_root(const char *path) {
+    pthread_mutex_lock(&g_topology.lock);
+    snprintf(g_topology.root, sizeof(g_topology.root), "%s", path ? path : PCI_SYSFS_DEVICES);
+    pci_topology_put(g_topology.current);
+    g_topology.current = NULL;
+    pthread_mutex_unlock(&g_topology.lock);
+}
+
+/* Read a function attribute */
+ssize_t pci_topology_read_attr(const char *address, const char *attr, void *buf, size_t size) {
+    if (!address || !attr || !buf || size == 0) {
+        return -1;
+    }
+    
+    char path[512];
+    pthread_mutex_lock(&g_topology.lock);
+    snprintf(path, sizeof(path), "%s/%s/%s", g_topology.root, address, attr);
+    pthread_mutex_unlock(&g_topology.lock);
+    
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    ssize_t n = pread(fd, buf, size, 0);
+    close(fd);
+    return n;
+}
+
+/* Read NUMA locality */
+void pci_topology_read_locality(pci_function_t *function) {
+    if (!function) {
+        return;
+    }
+    
+    char root[256];
+    pthread_mutex_lock(&g_topology.lock);
+    snprintf(root, sizeof(root), "%s", g_topology.root);
+    pthread_mutex_unlock(&g_topology.lock);
+    
+    int root_fd = open(root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (root_fd < 0) {
+        function->numa_node = -1;
+        function->local_cpulist[0] = '\0';
+        return;
+    }
+    read_locality(root_fd, function->address, function);
+    close(root_fd);
+}
+
+/* Set persistent cache */
+void pci_topology_set_cache(const char *path) {
+    pthread_mutex_lock(&g_topology.lock);
+    snprintf(g_topology.cache_path, sizeof(g_topology.cache_path), "%s", path ? path : "");
+    pthread_mutex_unlock(&g_topology.lock);
+}
+
+/* Find function by address */
+const pci_function_t* pci_topology_find(const pci_topology_t *topology, const char *address) {
+    if (!topology || !address) {
+        return NULL;
+    }
+    
+    /* Functions are sorted by address */
+    uint32_t lo = 0;
+    uint32_t hi = topology->count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        int cmp = strcmp(topology->functions[mid].address, address);
+        if (cmp == 0) {
+            return &topology->functions[mid];
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    
+    return NULL;
+}
+
+/* Find root port */
+const pci_function_t* pci_topology_root_port(const pci_topology_t *topology, const char *address) {
+    const pci_function_t *fn = pci_topology_find(topology, address);
+    const pci_function_t *port = NULL;
+    
+    /* Bounded, in case a damaged cache links the hierarchy into a loop */
+    for (int depth = 0; fn && fn->parent[0] != '\0' && depth < 32; depth++) {
+        fn = pci_topology_find(topology, fn->parent);
+        if (fn) {
+            port = fn;
+        }
+    }
+    
+    return port;
+}
@@ -0,0 +1,194 @@
+/*
+ * ParrotWinKernel - PCI Topology
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * PCI Topology
+ * 
+ * Cached enumeration of the PCI functions exposed under sysfs, shared by
+ * chipset detection and later hardware discovery.
+ */
+
+#ifndef PCI_TOPOLOGY_H
+#define PCI_TOPOLOGY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+#define PCI_SYSFS_DEVICES       "/sys/bus/pci/devices"
+#define PCI_BOOT_ID             "/proc/sys/kernel/random/boot_id"
+#define PCI_TOPOLOGY_CACHE      "/var/cache/parrot_winkernel/pci_topology.cache"
+
+/* One PCI function */
+typedef struct {
+    char address[16];           /* Domain:bus:device.function */
+    char parent[16];            /* Upstream bridge, empty on a root bus */
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t subsys_vendor_id;
+    uint32_t subsys_device_id;
+    uint32_t class_code;        /* Class, subclass, prog-if */
+    int32_t numa_node;          /* -1 if unknown or not a NUMA system */
+    char local_cpulist[64];     /* CPUs near the device, e.g. "0-15,32-47" */
+} pci_function_t;
+
+/* Immutable enumeration result, sorted by address */
+typedef struct {
+    uint32_t refs;
+    uint64_t generation;        /* Increments with every new snapshot */
+    uint64_t fingerprint;       /* Boot ID + device list */
+    uint64_t scan_ns;           /* Time the scan (or cache load) took */
+    bool from_cache;            /* Loaded from the persistent cache */
+    bool incremental;           /* Patched by hotplug events since the last scan */
+    uint32_t count;
+    pci_function_t functions[];
+} pci_topology_t;
+
+/* API Functions */
+
+/**
+ * pci_topology_get - Get the cached topology, scanning on first use
+ * 
+ * On first use in a process, a persistent cache written during the same
+ * boot is used without scanning. A background thread then compares the
+ * device list against the cache's fingerprint. On a mismatch it does a
+ * full scan and replaces the snapshot.
+ * 
+ * Returns: Referenced snapshot (release with pci_topology_put()), NULL on error
+ */
+const pci_topology_t* pci_topology_get(void);
+
+/**
+ * pci_topology_put - Release a snapshot from pci_topology_get()
+ * @topology: Snapshot to release (may be NULL)
+ */
+void pci_topology_put(const pci_topology_t *topology);
+
+/**
+ * pci_topology_rescan - Enumerate again and replace the cached snapshot
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int pci_topology_rescan(void);
+
+/**
+ * pci_topology_add - Add or replace one function in the cached snapshot
+ * @function: Function reported by a hotplug event
+ * 
+ * Publishes a new snapshot without rescanning. Does nothing if no
+ * snapshot has been taken yet (the first scan will see the function).
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int pci_topology_add(const pci_function_t *function);
+
+/**
+ * pci_topology_remove - Remove one function from the cached snapshot
+ * @address: Domain:bus:device.function
+ * 
+ * Returns: 0 on success (including when absent), negative on error
+ */
+int pci_topology_remove(const char *address);
+
+/**
+ * pci_topology_set_root - Enumerate a different sysfs devices directory
+ * @path: Directory laid out like /sys/bus/pci/devices (NULL = default)
+ * 
+ * Drops the cached snapshot. Intended for tests and emulated systems.
+ */
+void pci_topology_set_root(const char *path);
+
+/**
+ * pci_topology_set_cache - Set the persistent cache file
+ * @path: Cache file (NULL disables the persistent cache)
+ * 
+ * Each full scan rewrites the file atomically.
+ */
+void pci_topology_set_cache(const char *path);
+
+/**
+ * pci_topology_read_attr - Read a sysfs attribute of a function
+ * @address: Domain:bus:device.function
+ * @attr: Attribute file, e.g. "config" or "resource"
+ * @buf: Output buffer (raw bytes, not terminated)
+ * @size: Buffer size
+ * 
+ * Returns: Bytes read, or -1 on error
+ */
+ssize_t pci_topology_read_attr(const char *address, const char *attr, void *buf, size_t size);
+
+/**
+ * pci_topology_parent - Upstream bridge from a sysfs device path
+ * @devpath: Device path, e.g. /devices/pci0000:00/0000:00:1c.0/0000:02:00.0
+ * @parent: Output address (at least 16 bytes), empty on a root bus
+ */
+void pci_topology_parent(const char *devpath, char *parent);
+
+/**
+ * pci_topology_read_locality - Fill a function's NUMA node and local CPUs
+ * @function: Function with its address set (e.g. from a hotplug event)
+ */
+void pci_topology_read_locality(pci_function_t *function);
+
+/**
+ * pci_topology_root_port - Topmost upstream bridge of a function
+ * @topology: Snapshot
+ * @address: Domain:bus:device.function
+ * 
+ * Functions below the same root port share its link to the root complex.
+ * 
+ * Returns: Root port, or NULL if the function is on a root bus or absent
+ */
+const pci_function_t* pci_topology_root_port(const pci_topology_t *topology, const char *address);
+
+/**
+ * pci_topology_find - Look up a function by address
+ * @topology: Snapshot
+ * @address: Domain:bus:device.function
+ * 
+ * Returns: Function, or NULL if not present
+ */
+const pci_function_t* pci_topology_find(const pci_topology_t *topology, const char *address);
+
+#endif /* PCI_TOPOLOGY_H */
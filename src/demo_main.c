@@ -66,13 +66,27 @@
 #include "ai_buffer/ai_buffer.h"
 #include "kernel_bridge/kernel_bridge.h"
 #include "chipset_drivers/chipset_driver.h"
+#include "chipset_drivers/chipset_hotplug.h"
+#include "chipset_drivers/chipset_loader.h"
+#include "chipset_drivers/chipset_emu.h"
+
+/* Bridge settings reloaded on change or SIGHUP */
+#define DEMO_BRIDGE_CONFIG "bridge.conf"
+
+/* Longest wait for a device's async reads to complete */
+#define DEMO_ASYNC_TIMEOUT_MS 1000
 
 static bool g_running = true;
 
+/* Serve devices from the emulator's models (--emulate) */
+static bool g_emulate = false;
+
 void signal_handler(int sig) {
     if (sig == SIGINT || sig == SIGTERM) {
         printf("\n[DEMO] Received signal, shutting down...\n");
         g_running = false;
+    } else if (sig == SIGHUP) {
+        bridge_request_reload();
     }
 }
 
@@ -89,10 +103,10 @@ void demonstrate_ai_buffer(void) {
     
     /* Test AI prediction on sample requests */
     comm_request_t test_requests[] = {
-        {REQ_IO_READ, 0x8086, 0x1000, 64, NULL, 0, 0, 5},
-        {REQ_IO_WRITE, 0x8086, 0x2000, 128, NULL, 0, 0, 7},
-        {REQ_DMA_ALLOC, 0x1022, 0x0, 4096, NULL, 0, 0, 10},
-        {REQ_PCI_CONFIG, 0x10DE, 0x100, 4, NULL, 0, 0, 3},
+        {REQ_IO_READ, 0x8086, 0x1000, 64, NULL, 0, 0, 5, NULL, 0},
+        {REQ_IO_WRITE, 0x8086, 0x2000, 128, NULL, 0, 0, 7, NULL, 0},
+        {REQ_DMA_ALLOC, 0x1022, 0x0, 4096, NULL, 0, 0, 10, NULL, 0},
+        {REQ_PCI_CONFIG, 0x10DE, 0x100, 4, NULL, 0, 0, 3, NULL, 0},
     };
     
     for (int i = 0; i < 4; i++) {
@@ -125,6 +139,16 @@ void demonstrate_ai_buffer(void) {
     printf("  Avg Latency: %u μs\n", avg_latency);
 }
 
+static volatile int g_async_done = 0;
+
+static void async_read_done(chipset_driver_t *driver, int status,
+                            uint32_t offset, uint32_t value, void *user_data) {
+    (void)user_data;
+    printf("   ✓ Async read 0x%x from %s: 0x%08x (status %d)\n",
+           offset, driver->name, value, status);
+    __atomic_add_fetch(&g_async_done, 1, __ATOMIC_RELAXED);
+}
+
 void demonstrate_chipset_detection(void) {
     printf("\n═══ Chipset Detection Demonstration ═══\n\n");
     
@@ -135,19 +159,33 @@ void demonstrate_chipset_detection(void) {
     if (ret == CHIPSET_SUCCESS) {
         printf("Detected %u chipsets:\n\n", count);
         
+        /* Load in dependency order, independent drivers in parallel */
+        chipset_load_result_t results[32];
+        chipset_load_report_t report;
+        ret = chipset_load_all(detected, count, 0, results, &report);
+        if (ret != CHIPSET_SUCCESS && ret != CHIPSET_ERR_LOAD_FAILED) {
+            /* No per-driver results to report */
+            printf("Driver loading failed (code: %d)\n", ret);
+            return;
+        }
+        
         for (uint32_t i = 0; i < count; i++) {
             printf("%u. %s\n", i+1, detected[i].name);
             printf("   Vendor: %s\n", detected[i].vendor);
             printf("   VID:DID: 0x%04x:0x%04x\n", 
                    detected[i].vendor_id, detected[i].device_id);
             printf("   Type: %d\n", detected[i].chipset_type);
-            printf("   Driver: %s\n\n", detected[i].driver_path);
+            printf("   Driver: %s\n", detected[i].driver_path);
+            if (detected[i].numa_node >= 0) {
+                printf("   NUMA node: %d (CPUs %s)\n", detected[i].numa_node,
+                       detected[i].local_cpulist);
+            }
+            printf("\n");
             
-            /* Try to load the driver */
-            printf("   Loading driver...\n");
-            ret = chipset_load_driver(&detected[i]);
+            ret = results[i].status;
             if (ret == CHIPSET_SUCCESS) {
-                printf("   ✓ Driver loaded successfully\n");
+                printf("   ✓ Driver loaded in %lu us%s\n", (unsigned long)results[i].load_us,
+                       results[i].critical ? " (critical path)" : "");
                 
                 /* Get capabilities */
                 driver_capabilities_t caps;
@@ -161,8 +199,9 @@ void demonstrate_chipset_detection(void) {
                     printf("     Max Transfer: %u bytes\n", caps.max_transfer_size);
                 }
                 
-                /* Test register operations */
+                /* Test register operations, profiling which registers are hit */
                 printf("   Testing register operations...\n");
+                chipset_profile_enable(&detected[i], true);
                 uint32_t reg_val;
                 if (chipset_read_register(&detected[i], 0x0, &reg_val) == CHIPSET_SUCCESS) {
                     printf("   ✓ Read register 0x0: 0x%08x\n", reg_val);
@@ -172,11 +211,54 @@ void demonstrate_chipset_detection(void) {
                     printf("   ✓ Write register 0x4: 0xDEADBEEF\n");
                 }
                 
-                /* Test power management */
-                printf("   Testing power management...\n");
-                chipset_power_management(&detected[i], 3); /* D3 state */
-                chipset_power_management(&detected[i], 0); /* D0 state */
-                printf("   ✓ Power state transitions OK\n");
+                /* Keep several reads in flight from this one thread */
+                int submitted = 0;
+                g_async_done = 0;
+                for (uint32_t reg = 0x10; reg < 0x20; reg += 4) {
+                    if (chipset_read_register_async(&detected[i], reg, async_read_done,
+                                                    NULL) == CHIPSET_SUCCESS) {
+                        submitted++;
+                    }
+                }
+                int waited_ms = 0;
+                while (__atomic_load_n(&g_async_done, __ATOMIC_RELAXED) < submitted &&
+                       waited_ms < DEMO_ASYNC_TIMEOUT_MS) {
+                    usleep(1000);
+                    waited_ms++;
+                }
+                int pending = submitted - __atomic_load_n(&g_async_done, __ATOMIC_RELAXED);
+                if (pending > 0) {
+                    printf("   ⚠ %d of %d async reads still pending\n", pending, submitted);
+                }
+                
+                /* Test power management: suspend when idle, resume on demand */
+                printf("   Testing runtime power management...\n");
+                chipset_runtime_pm_t pm = { .autosuspend_delay_ms = 20, .suspend_state = 3 };
+                if (chipset_runtime_pm_enable(&detected[i], &pm) == CHIPSET_SUCCESS) {
+                    usleep(50000);
+                    chipset_read_register(&detected[i], 0x0, &reg_val);
+                    
+                    chipset_pm_stats_t pm_stats;
+                    if (chipset_get_pm_stats(&detected[i], &pm_stats) == CHIPSET_SUCCESS) {
+                        printf("   ✓ %lu suspends, %lu resumes (max %lu us)\n",
+                               (unsigned long)pm_stats.suspends, (unsigned long)pm_stats.resumes,
+                               (unsigned long)pm_stats.resume_max_us);
+                    }
+                }
+                
+                char heatmap[2048];
+                if (chipset_profile_heatmap(&detected[i], heatmap, sizeof(heatmap)) > 0) {
+                    printf("   %s", heatmap);
+                }
+                chipset_profile_enable(&detected[i], false);
+                
+                chipset_emu_stats_t emu_stats;
+                if (g_emulate && chipset_emu_get_stats(&detected[i], &emu_stats) == CHIPSET_SUCCESS) {
+                    printf("   Emulated device: %lu reads, %lu writes, %lu us busy\n",
+                           (unsigned long)emu_stats.register_reads,
+                           (unsigned long)emu_stats.register_writes,
+                           (unsigned long)(emu_stats.busy_ns / 1000));
+                }
                 
             } else {
                 printf("   ⚠ Driver load failed (code: %d)\n", ret);
@@ -195,9 +277,9 @@ void demonstrate_kernel_bridge(void) {
     printf("Sending test requests through bridge...\n\n");
     
     comm_request_t requests[] = {
-        {REQ_IO_READ, 0x8086, 0x1000, 64, NULL, 0, 0, 5},
-        {REQ_IO_WRITE, 0x1022, 0x2000, 128, NULL, 0, 0, 7},
-        {REQ_DMA_ALLOC, 0x10DE, 0x0, 8192, NULL, 0, 0, 10},
+        {REQ_IO_READ, 0x8086, 0x1000, 64, NULL, 0, 0, 5, NULL, 0},
+        {REQ_IO_WRITE, 0x1022, 0x2000, 128, NULL, 0, 0, 7, NULL, 0},
+        {REQ_DMA_ALLOC, 0x10DE, 0x0, 8192, NULL, 0, 0, 10, NULL, 0},
     };
     
     /* Wait a bit for worker thread to process */
@@ -216,6 +298,20 @@ void demonstrate_kernel_bridge(void) {
     printf("  Failures: %lu\n", stats.failures);
     printf("  AI Accuracy: %.2f%%\n", stats.ai_accuracy * 100.0f);
     printf("  Avg Latency: %u μs\n", stats.avg_latency_us);
+    printf("  Workers: %u (scale ups: %lu, scale downs: %lu)\n",
+           stats.active_workers, stats.scale_ups, stats.scale_downs);
+    printf("  Queue Depth: %u (avg wait: %u μs)\n",
+           stats.queue_depth, stats.avg_queue_wait_us);
+    printf("  Worker Utilization: %.2f%%\n", stats.worker_utilization * 100.0f);
+    
+    bridge_latency_hist_t sync_latency;
+    if (bridge_get_sync_latency(&sync_latency) == BRIDGE_SUCCESS && sync_latency.count > 0) {
+        printf("  Sync Reads: %lu (p50 < %lu ns, p99 < %lu ns, timeouts: %lu)\n",
+               sync_latency.count,
+               bridge_latency_percentile(&sync_latency, 50.0f),
+               bridge_latency_percentile(&sync_latency, 99.0f),
+               stats.sync_timeouts);
+    }
 }
 
 void run_integration_test(void) {
@@ -235,10 +331,15 @@ void run_integration_test(void) {
             /* Perform operations that go through AI and bridge */
             printf("Performing operations...\n");
             
+            /* One round trip for the whole block */
+            chipset_reg_t regs[5];
             for (int i = 0; i < 5; i++) {
-                uint32_t val;
-                chipset_read_register(&detected[0], i * 4, &val);
-                usleep(100000); /* 100ms */
+                regs[i].offset = i * 4;
+            }
+            if (chipset_read_registers(&detected[0], regs, 5) == CHIPSET_SUCCESS) {
+                for (int i = 0; i < 5; i++) {
+                    printf("  Register 0x%02x: 0x%08x\n", regs[i].offset, regs[i].value);
+                }
             }
             
             printf("✓ Operations complete\n");
@@ -252,12 +353,19 @@ void run_integration_test(void) {
     printf("\n✓ Integration test complete\n");
 }
 
-int main(void) {
+int main(int argc, char *argv[]) {
     int ret;
     
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--emulate") == 0) {
+            g_emulate = true;
+        }
+    }
+    
     /* Setup signal handler */
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
+    signal(SIGHUP, signal_handler);
     
     print_banner();
     
@@ -279,7 +387,12 @@ int main(void) {
         .ai_enabled = true,
         .max_pending_requests = 1024,
         .batch_timeout_ms = 10,
-        .chipset_type = CHIPSET_INTEL
+        .chipset_type = CHIPSET_INTEL,
+        .min_workers = 1,
+        .max_workers = 4,
+        .queues_per_device = 2,
+        .queue_depth = 256,
+        .numa_affinity = true
     };
     
     ret = bridge_init(&bridge_config);
@@ -288,7 +401,11 @@ int main(void) {
         ai_buffer_shutdown();
         return 1;
     }
-    printf("  ✓ Kernel Bridge initialized\n\n");
+    printf("  ✓ Kernel Bridge initialized\n");
+    if (bridge_watch_config(DEMO_BRIDGE_CONFIG) == BRIDGE_SUCCESS) {
+        printf("  ✓ Live config: edit %s or send SIGHUP to reload\n", DEMO_BRIDGE_CONFIG);
+    }
+    printf("\n");
     
     /* Initialize chipset subsystem */
     printf("[3/3] Initializing Chipset Driver Subsystem...\n");
@@ -299,7 +416,11 @@ int main(void) {
         ai_buffer_shutdown();
         return 1;
     }
-    printf("  ✓ Chipset subsystem initialized\n\n");
+    printf("  ✓ Chipset subsystem initialized\n");
+    if (g_emulate && chipset_emu_enable(NULL) == CHIPSET_SUCCESS) {
+        printf("  ✓ Devices served by the chipset emulator\n");
+    }
+    printf("\n");
     
     printf("═══════════════════════════════════════════════════════\n");
     printf("All systems operational!\n");
@@ -315,6 +436,11 @@ int main(void) {
     printf("Demonstration complete!\n");
     printf("═══════════════════════════════════════════════════════\n\n");
     
+    /* Pick up devices added or removed while running */
+    if (chipset_hotplug_start(-1, true, NULL, NULL) == CHIPSET_SUCCESS) {
+        printf("Watching for PCI hotplug events\n");
+    }
+    
     printf("Press Ctrl+C to exit...\n");
     
     /* Keep running for monitoring */
@@ -324,6 +450,7 @@ int main(void) {
     
     /* Cleanup */
     printf("\nShutting down systems...\n");
+    chipset_hotplug_stop();
     chipset_shutdown();
     bridge_shutdown();
     ai_buffer_shutdown();
@@ -49,362 +49,2407 @@
  * with AI-assisted communication buffering.
  */
 
+#define _GNU_SOURCE                     /* CPU affinity */
 #include "kernel_bridge.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <pthread.h>
 #include <unistd.h>
+#include <time.h>
 #include <sys/time.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <stddef.h>
+#include <ctype.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/* Worker batching and scaling hysteresis */
+#define BRIDGE_WORKER_BATCH         64
+#define BRIDGE_SCALE_UP_SAMPLES     3       /* Pressured samples in a row before growing */
+#define BRIDGE_SCALE_DOWN_SAMPLES   20      /* Idle samples in a row before shrinking */
+#define BRIDGE_SCALE_UP_UTIL        0.80f
+#define BRIDGE_SCALE_DOWN_UTIL      0.25f
+#define BRIDGE_SCALE_HISTORY        64
+
+/* Synchronous wait tuning */
+#define BRIDGE_SPIN_MAX_NS          20000   /* Never spin longer than this */
+
+/* NUMA memory policy (mbind), without depending on libnuma headers */
+#define BRIDGE_MPOL_PREFERRED       1
+#define BRIDGE_MPOL_MF_MOVE         (1 << 1)
+#define BRIDGE_MAX_NODE_ID          1024
+
+/* Future states (futex word) */
+#define FUTURE_PENDING              0
+#define FUTURE_SLEEPING             1       /* Pending, waiter on the futex */
+#define FUTURE_DONE                 2
+#define FUTURE_REFS_WAITER          0x80000000u     /* Owner sleeps until refs drops to 1 */
+
+/* CPU hint for spin loops */
+#if defined(__x86_64__) || defined(__i386__)
+#define cpu_relax() __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define cpu_relax() __asm__ __volatile__("yield" ::: "memory")
+#else
+#define cpu_relax() __asm__ __volatile__("" ::: "memory")
+#endif
+
+/* Versioned configuration snapshot. Readers pin the current pointer
+ * without locking by recording its version in a per-thread slot;
+ * replaced snapshots wait on the retired chain until no reader holds
+ * one that old, then the next writer or a leaving reader frees them. */
+typedef struct bridge_config_snapshot {
+    uint64_t version;
+    bridge_config_t config;
+    struct bridge_config_snapshot *retired;
+} bridge_config_snapshot_t;
 
 /* Global bridge state */
 static struct {
     bool initialized;
-    bridge_config_t config;
+    bridge_config_snapshot_t *config;
+    pthread_mutex_t config_lock;    /* Serializes writers of 'config' */
+    uint64_t config_epoch;          /* Version of the snapshot in effect */
+    uint32_t config_readers;        /* Pins by threads without a reader slot */
+    bool config_retired;            /* Retired chain waits for reclaim */
+    uint64_t config_reclaimed;      /* Retired snapshots freed */
+    bool ai_started;
     bridge_stats_t stats;
     device_context_t *devices[256];
     uint32_t device_count;
     pthread_mutex_t lock;
-    pthread_t worker_thread;
     bool worker_running;
+    const bridge_backend_t *backend;    /* NULL = built-in simulation */
 } g_bridge = {0};
 
-/* Request queue for batching */
+/* Submission queue entry */
+typedef struct {
+    comm_request_t req;
+    uint64_t enqueue_ns;
+    bridge_completion_fn callback;
+    void *user_data;
+    bool silent;                /* Completes without callback or CQE */
+    bool data_inline;
+    uint8_t inline_data[BRIDGE_INLINE_DATA];
+} bridge_sqe_t;
+
+/* Submission/completion queue pair */
+struct bridge_queue_pair {
+    device_context_t *ctx;
+    uint32_t qid;
+    uint32_t mask;              /* Queue depth - 1 */
+    pthread_mutex_t lock;
+    
+    /* Submission queue (free-running indices) */
+    bridge_sqe_t *sq;
+    uint32_t sq_head;           /* Next entry a worker takes */
+    uint32_t sq_doorbell;       /* Entries announced to the workers */
+    uint32_t sq_tail;           /* Next free entry */
+    
+    /* Completion queue */
+    bridge_completion_t *cq;
+    uint32_t cq_head;
+    uint32_t cq_tail;
+    
+    bool scheduled;             /* On the run list or being drained */
+    bridge_queue_pair_t *next;  /* Run list link */
+    int32_t batch_status;       /* First failure of the batch being drained */
+    
+    /* Pollable notification (created on first use, -1 until then) */
+    int cq_event_fd;
+    int sq_space_fd;
+    bool cq_signaled;           /* Completion fd written since last drain */
+    bool space_wanted;          /* A submission was refused for lack of space */
+    bool space_signaled;        /* Space fd written since last submission */
+};
+
+/* Run list of doorbelled queue pairs */
 static struct {
-    comm_request_t requests[1024];
-    device_context_t *contexts[1024];
-    uint32_t head;
-    uint32_t tail;
-    uint32_t count;
+    bridge_queue_pair_t *head;
+    bridge_queue_pair_t *tail;
+    uint32_t pending;           /* Announced requests not yet taken */
+    uint64_t doorbells;
+    uint64_t cq_overflows;
+    uint64_t event_signals;
+    uint32_t inflight;          /* Admitted requests not yet completed */
+    double tokens;              /* Rate limit token bucket */
+    uint64_t refill_ns;
+    uint64_t rate_limited;
     pthread_mutex_t lock;
     pthread_cond_t not_empty;
+    pthread_cond_t drained;     /* A pair went idle (only while someone waits) */
+    uint64_t drains;            /* Pairs gone idle while someone waited */
+    uint32_t drain_waiters;
 } g_queue = {0};
 
+/* Next queue pair handed to a new submitting thread */
+static uint32_t g_queue_hint_next = 0;
+static __thread uint32_t tls_queue_hint = UINT32_MAX;
+
+/* Worker pool and scaler state (protected by g_queue.lock) */
+static struct {
+    struct {
+        pthread_t thread;
+        bool active;
+        bool exited;
+    } workers[BRIDGE_MAX_WORKERS];
+    uint32_t live;              /* Workers currently running */
+    uint32_t retire;            /* Workers asked to exit */
+    uint64_t dequeued;          /* Requests handed to workers */
+    uint64_t wait_ns;           /* Queue wait of dequeued requests */
+    uint64_t busy_ns;           /* Time workers spent processing */
+    pthread_t scaler_thread;
+    pthread_cond_t scaler_cond;
+    bool scaler_parked;
+    uint32_t up_streak;
+    uint32_t down_streak;
+    uint32_t last_wait_us;
+    float last_utilization;
+    uint64_t scale_ups;
+    uint64_t scale_downs;
+    bridge_scale_event_t history[BRIDGE_SCALE_HISTORY];
+    uint64_t history_count;
+} g_pool = {0};
+
+/* Waitable completion */
+struct bridge_future {
+    uint32_t state;             /* FUTURE_* (futex word) */
+    uint32_t refs;              /* Owner + in-flight request (futex word on reuse) */
+    uint64_t submit_ns;
+    bool round_trip;            /* Single-register read; its wait feeds the latency stats */
+    bridge_completion_t completion;
+    void *buffer;               /* Scratch space owned by the future */
+    size_t buffer_size;
+};
+
+/* Synchronous wait statistics (updated atomically) */
+static struct {
+    bool spin_enabled;          /* Spinning only helps with another CPU to complete */
+    uint64_t rtt_ewma_ns;
+    uint64_t spin_hits;
+    uint64_t sleeps;
+    uint64_t timeouts;
+    bridge_latency_hist_t hist;
+} g_sync = {0};
+
+/* NUMA placement (protected by g_queue.lock) */
+static struct {
+    struct {
+        int32_t node;
+        cpu_set_t cpus;
+        pthread_cond_t wake;    /* Idle workers placed on this node */
+        uint32_t idle;
+    } nodes[BRIDGE_MAX_NODES];
+    uint32_t node_count;        /* Only grows until shutdown */
+    uint32_t unpinned_idle;     /* Idle workers waiting on g_queue.not_empty */
+    uint64_t generation;        /* Bumped when nodes or the worker count change */
+    cpu_set_t process_cpus;     /* Affinity at init, restored when unpinned */
+    uint64_t local_dispatches;
+    uint64_t remote_dispatches;
+} g_affinity;
+
+/* Config file watcher */
+static struct {
+    bool running;
+    pthread_t thread;
+    int inotify_fd;
+    int wake_fd;                /* Reload requests and stop */
+    int signal_fd;              /* wake_fd while reload requests may use it, else -1 */
+    uint32_t signalers;         /* Reload requests between loading and writing it */
+    char path[256];
+    char name[256];
+} g_watch = {false, 0, -1, -1, -1, 0, "", ""};
+
+/* Per-thread configuration reader, on its own cache line so pins do
+ * not bounce between cores. Slots outlive their threads and are reused,
+ * so a writer scanning the list never touches freed memory. */
+typedef struct config_reader {
+    uint64_t epoch;                 /* Oldest version pinned, 0 when idle */
+    uint32_t depth;                 /* Nested cfg_get() calls (owner only) */
+    bool in_use;                    /* Owned by a live thread */
+    struct config_reader *next;
+} __attribute__((aligned(64))) config_reader_t;
+
+static config_reader_t *g_config_readers;      /* Push-only list */
+static config_reader_t g_reader_fallback;      /* Marks threads without a slot */
+static pthread_key_t g_reader_key;
+static pthread_once_t g_reader_once = PTHREAD_ONCE_INIT;
+static __thread config_reader_t *tls_reader;
+
+/* Helper: hand a slot back when its thread exits */
+static void reader_key_destroy(void *reader) {
+    __atomic_store_n(&((config_reader_t*)reader)->in_use, false, __ATOMIC_RELEASE);
+}
+
+static void reader_key_init(void) {
+    pthread_key_create(&g_reader_key, reader_key_destroy);
+}
+
+/* Helper: this thread's reader slot, claimed on first use */
+static config_reader_t* config_reader(void) {
+    config_reader_t *reader = tls_reader;
+    if (reader) {
+        return reader;
+    }
+    
+    pthread_once(&g_reader_once, reader_key_init);
+    for (reader = __atomic_load_n(&g_config_readers, __ATOMIC_ACQUIRE); reader;
+         reader = reader->next) {
+        bool taken = false;
+        if (__atomic_compare_exchange_n(&reader->in_use, &taken, true, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+    if (!reader) {
+        void *mem = NULL;
+        if (posix_memalign(&mem, sizeof(config_reader_t), sizeof(config_reader_t)) != 0) {
+            /* Pins through the shared count instead */
+            tls_reader = &g_reader_fallback;
+            return tls_reader;
+        }
+        reader = (config_reader_t*)mem;
+        memset(reader, 0, sizeof(*reader));
+        reader->in_use = true;
+        reader->next = __atomic_load_n(&g_config_readers, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&g_config_readers, &reader->next, reader, false,
+                                            __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+        }
+    }
+    
+    pthread_setspecific(g_reader_key, reader);
+    tls_reader = reader;
+    return reader;
+}
+
+/* Helper: configuration currently in effect (config_lock held, or
+ * before the workers start) */
+static inline const bridge_config_t* cfg(void) {
+    return &__atomic_load_n(&g_bridge.config, __ATOMIC_ACQUIRE)->config;
+}
+
+/* Helper: free retired snapshots no reader can hold (config_lock held).
+ * A reader records the epoch before loading the pointer, and the writer
+ * publishes the pointer, then the epoch, before scanning. So a reader
+ * holds a snapshot at least as new as its recorded epoch, and a reader
+ * the scan missed can only see the current snapshot. */
+static void reclaim_config(void) {
+    bridge_config_snapshot_t *snap = g_bridge.config;
+    if (!snap || !snap->retired ||
+        __atomic_load_n(&g_bridge.config_readers, __ATOMIC_SEQ_CST) != 0) {
+        return;
+    }
+    
+    uint64_t oldest = UINT64_MAX;
+    for (config_reader_t *reader = __atomic_load_n(&g_config_readers, __ATOMIC_ACQUIRE);
+         reader; reader = reader->next) {
+        uint64_t epoch = __atomic_load_n(&reader->epoch, __ATOMIC_SEQ_CST);
+        if (epoch != 0 && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+    
+    /* The chain runs newest to oldest */
+    bridge_config_snapshot_t **link = &snap->retired;
+    while (*link && (*link)->version >= oldest) {
+        link = &(*link)->retired;
+    }
+    bridge_config_snapshot_t *retired = *link;
+    *link = NULL;
+    if (!snap->retired) {
+        __atomic_store_n(&g_bridge.config_retired, false, __ATOMIC_RELEASE);
+    }
+    while (retired) {
+        bridge_config_snapshot_t *next = retired->retired;
+        free(retired);
+        retired = next;
+        __atomic_add_fetch(&g_bridge.config_reclaimed, 1, __ATOMIC_RELAXED);
+    }
+}
+
+/* Helper: pin the snapshot in effect (lock-free); pair with cfg_put() */
+static inline const bridge_config_snapshot_t* snapshot_get(void) {
+    config_reader_t *reader = config_reader();
+    if (reader == &g_reader_fallback) {
+        __atomic_add_fetch(&g_bridge.config_readers, 1, __ATOMIC_SEQ_CST);
+    } else if (reader->depth++ == 0) {
+        __atomic_store_n(&reader->epoch, __atomic_load_n(&g_bridge.config_epoch, __ATOMIC_SEQ_CST),
+                         __ATOMIC_SEQ_CST);
+    }
+    return __atomic_load_n(&g_bridge.config, __ATOMIC_SEQ_CST);
+}
+
+static inline const bridge_config_t* cfg_get(void) {
+    return &snapshot_get()->config;
+}
+
+/* Helper: unpin; a reader leaving while snapshots wait frees what it can */
+static inline void cfg_put(void) {
+    config_reader_t *reader = tls_reader;
+    if (reader == &g_reader_fallback) {
+        __atomic_sub_fetch(&g_bridge.config_readers, 1, __ATOMIC_SEQ_CST);
+    } else if (--reader->depth == 0) {
+        __atomic_store_n(&reader->epoch, 0, __ATOMIC_SEQ_CST);
+    } else {
+        return;
+    }
+    
+    if (__atomic_load_n(&g_bridge.config_retired, __ATOMIC_ACQUIRE) &&
+        pthread_mutex_trylock(&g_bridge.config_lock) == 0) {
+        /* Otherwise a later reader or writer reclaims */
+        reclaim_config();
+        pthread_mutex_unlock(&g_bridge.config_lock);
+    }
+}
+
+/* Helper: monotonic clock in nanoseconds */
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Helper: append a queue pair to the run list (g_queue.lock held) */
+static void run_list_push(bridge_queue_pair_t *qp) {
+    qp->next = NULL;
+    if (g_queue.tail) {
+        g_queue.tail->next = qp;
+    } else {
+        g_queue.head = qp;
+    }
+    g_queue.tail = qp;
+    
+    /* Wake an idle worker on the pair's node, else an unplaced one, else any */
+    uint32_t target = g_affinity.node_count;
+    for (uint32_t n = 0; n < g_affinity.node_count; n++) {
+        if (g_affinity.nodes[n].idle > 0 &&
+            (target == g_affinity.node_count || g_affinity.nodes[n].node == qp->ctx->numa_node)) {
+            target = n;
+        }
+    }
+    if (target < g_affinity.node_count &&
+        (g_affinity.nodes[target].node == qp->ctx->numa_node || g_affinity.unpinned_idle == 0)) {
+        pthread_cond_signal(&g_affinity.nodes[target].wake);
+    } else {
+        pthread_cond_signal(&g_queue.not_empty);
+    }
+    
+    /* Wake the scaler if it parked while idle */
+    if (g_pool.scaler_parked) {
+        g_pool.scaler_parked = false;
+        pthread_cond_signal(&g_pool.scaler_cond);
+    }
+}
+
+/* Helper: wake every worker, wherever it waits (g_queue.lock held) */
+static void wake_workers(void) {
+    pthread_cond_broadcast(&g_queue.not_empty);
+    for (uint32_t n = 0; n < g_affinity.node_count; n++) {
+        pthread_cond_broadcast(&g_affinity.nodes[n].wake);
+    }
+}
+
+/* Helper: take a queue pair off the run list, the first one on the home
+ * node if any, else the first one (g_queue.lock held) */
+static bridge_queue_pair_t* run_list_pop(int32_t home) {
+    int32_t node = home >= 0 ? g_affinity.nodes[home].node : -1;
+    bridge_queue_pair_t *prev = NULL;
+    bridge_queue_pair_t *qp = g_queue.head;
+    if (node >= 0) {
+        for (bridge_queue_pair_t *p = g_queue.head, *pp = NULL; p; pp = p, p = p->next) {
+            if (p->ctx->numa_node == node) {
+                prev = pp;
+                qp = p;
+                break;
+            }
+        }
+    }
+    
+    if (qp) {
+        if (prev) {
+            prev->next = qp->next;
+        } else {
+            g_queue.head = qp->next;
+        }
+        if (g_queue.tail == qp) {
+            g_queue.tail = prev;
+        }
+        qp->next = NULL;
+        
+        /* Only placed workers and devices count toward locality */
+        if (node >= 0 && qp->ctx->numa_node >= 0) {
+            if (qp->ctx->numa_node == node) {
+                g_affinity.local_dispatches++;
+            } else {
+                g_affinity.remote_dispatches++;
+            }
+        }
+    }
+    return qp;
+}
+
+/* Helper: pin the calling worker to its share of the nodes; returns its
+ * home node index, or -1 if unpinned (g_queue.lock held, dropped for the call) */
+static int32_t place_worker(uint32_t slot, bool numa) {
+    int32_t home = -1;
+    cpu_set_t cpus = g_affinity.process_cpus;
+    
+    /* With fewer workers than nodes, pinning would strand some devices */
+    if (numa && g_affinity.node_count > 0 && g_pool.live >= g_affinity.node_count) {
+        home = (int32_t)(slot % g_affinity.node_count);
+        cpus = g_affinity.nodes[home].cpus;
+    }
+    
+    pthread_mutex_unlock(&g_queue.lock);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus) != 0) {
+        home = -1;
+    }
+    pthread_mutex_lock(&g_queue.lock);
+    
+    return home;
+}
+
+/* Helper: bump an eventfd; one write covers a whole batch */
+static void signal_event_fd(int fd) {
+    uint64_t one = 1;
+    if (write(fd, &one, sizeof(one)) < 0) {
+        /* Counter saturated; the fd is already readable */
+    }
+}
+
+/* Helper: reset an eventfd to not-readable */
+static void drain_event_fd(int fd) {
+    uint64_t value;
+    if (read(fd, &value, sizeof(value)) < 0) {
+        /* Nothing pending */
+    }
+}
+
+/* Helper: fill a read buffer with a repeating 32-bit value, starting at
+ * byte @pos of the transfer */
+static void fill_pattern(uint8_t *buf, uint32_t length, uint32_t value, uint32_t pos) {
+    const uint8_t *bytes = (const uint8_t*)&value;
+    for (uint32_t i = 0; i < length; i++) {
+        buf[i] = bytes[(pos + i) & 3];
+    }
+}
+
+/* Helper: execute one request against the Linux side */
+static void execute_request(device_context_t *ctx, const comm_request_t *req,
+                            bridge_completion_t *cqe) {
+    cqe->device_id = ctx->device_id;
+    cqe->type = req->type;
+    cqe->address = req->address;
+    cqe->value = 0;
+    cqe->status = BRIDGE_SUCCESS;
+    
+    if (ctx->backend) {
+        cqe->status = ctx->backend->execute(ctx, ctx->backend_state, req, &cqe->value);
+        return;
+    }
+    
+    /* Simulate forwarding to Linux kernel */
+    printf("[BRIDGE] Forward request type %d to Linux for device 0x%x\n",
+           req->type, ctx->device_id);
+    
+    /* Simulated read value until a real backend answers */
+    if (req->type == REQ_IO_READ) {
+        uint32_t value = 0x12345678;
+        cqe->value = value;
+        if (req->sg_count > 0) {
+            uint32_t pos = 0;
+            for (uint32_t i = 0; i < req->sg_count; i++) {
+                fill_pattern(req->sg[i].data, req->sg[i].length, value, pos);
+                pos += req->sg[i].length;
+            }
+        } else if (req->data) {
+            fill_pattern(req->data, req->size, value, 0);
+        }
+    }
+}
+
 /* Worker thread for processing requests */
 static void* worker_thread_func(void *arg) {
-    (void)arg;
+    uint32_t slot = (uint32_t)(uintptr_t)arg;
+    bridge_sqe_t batch[BRIDGE_WORKER_BATCH];
+    bridge_completion_t completions[BRIDGE_WORKER_BATCH];
+    
+    printf("[BRIDGE] Worker %u started\n", slot);
     
-    printf("[BRIDGE] Worker thread started\n");
+    int32_t home = -1;
+    uint64_t placed_generation = 0;
+    bool placed_numa = false;
+    
+    pthread_mutex_lock(&g_queue.lock);
     
     while (g_bridge.worker_running) {
+        /* Surplus workers leave when the scaler shrinks the pool */
+        if (g_pool.retire > 0) {
+            g_pool.retire--;
+            break;
+        }
+        
+        /* Follow the affinity policy as nodes, workers and config change */
+        bool numa = cfg_get()->numa_affinity;
+        cfg_put();
+        if (placed_generation != g_affinity.generation || placed_numa != numa) {
+            placed_generation = g_affinity.generation;
+            placed_numa = numa;
+            home = place_worker(slot, numa);
+            continue;
+        }
+        
+        /* Block until a doorbell arrives; idle workers cost no CPU */
+        bridge_queue_pair_t *qp = run_list_pop(home);
+        if (!qp) {
+            if (home >= 0) {
+                g_affinity.nodes[home].idle++;
+                pthread_cond_wait(&g_affinity.nodes[home].wake, &g_queue.lock);
+                g_affinity.nodes[home].idle--;
+            } else {
+                g_affinity.unpinned_idle++;
+                pthread_cond_wait(&g_queue.not_empty, &g_queue.lock);
+                g_affinity.unpinned_idle--;
+            }
+            continue;
+        }
+        
+        pthread_mutex_unlock(&g_queue.lock);
+        
+        /* Take a batch of announced entries; this worker owns the pair
+         * until it clears 'scheduled', so entries run in order */
+        uint64_t start = now_ns();
+        uint64_t wait_ns = 0;
+        pthread_mutex_lock(&qp->lock);
+        uint32_t batch_size = qp->sq_doorbell - qp->sq_head;
+        if (batch_size > BRIDGE_WORKER_BATCH) {
+            batch_size = BRIDGE_WORKER_BATCH;
+        }
+        for (uint32_t i = 0; i < batch_size; i++) {
+            memcpy(&batch[i], &qp->sq[qp->sq_head & qp->mask], sizeof(bridge_sqe_t));
+            if (batch[i].data_inline) {
+                batch[i].req.data = batch[i].inline_data;
+            }
+            wait_ns += start - batch[i].enqueue_ns;
+            qp->sq_head++;
+        }
+        
+        /* Entries were freed; tell a refused submitter once */
+        uint32_t signals = 0;
+        if (batch_size > 0 && qp->space_wanted && qp->sq_space_fd >= 0) {
+            signal_event_fd(qp->sq_space_fd);
+            qp->space_wanted = false;
+            qp->space_signaled = true;
+            signals++;
+        }
+        pthread_mutex_unlock(&qp->lock);
+        
+        device_context_t *ctx = qp->ctx;
+        printf("[BRIDGE] Worker %u processing batch of %u requests (device 0x%x queue %u)\n",
+               slot, batch_size, ctx->device_id, qp->qid);
+        
+        bool ai_enabled = cfg_get()->ai_enabled;
+        cfg_put();
+        uint64_t optimized = 0;
+        uint32_t posted = 0;
+        for (uint32_t i = 0; i < batch_size; i++) {
+            comm_request_t *req = &batch[i].req;
+            bridge_completion_t *cqe = &completions[posted];
+            
+            /* Process request */
+            if (ai_enabled) {
+                ai_prediction_t prediction;
+                if (ai_buffer_process_request(req, &prediction) == AI_SUCCESS) {
+                    printf("[BRIDGE] AI decision: %d (confidence: %.2f)\n",
+                           prediction.decision, prediction.confidence);
+                    optimized++;
+                }
+            }
+            
+            execute_request(ctx, req, cqe);
+            cqe->queue_id = qp->qid;
+            cqe->user_data = batch[i].user_data;
+            cqe->latency_ns = now_ns() - batch[i].enqueue_ns;
+            
+            /* A batch reports its first failure on its last entry */
+            if (batch[i].silent) {
+                if (cqe->status != BRIDGE_SUCCESS && qp->batch_status == BRIDGE_SUCCESS) {
+                    qp->batch_status = cqe->status;
+                }
+            } else if (batch[i].callback && qp->batch_status != BRIDGE_SUCCESS) {
+                if (cqe->status == BRIDGE_SUCCESS) {
+                    cqe->status = qp->batch_status;
+                }
+                qp->batch_status = BRIDGE_SUCCESS;
+            }
+            
+            /* Callback requests complete here; the rest go to the completion queue */
+            if (batch[i].callback) {
+                batch[i].callback(ctx, cqe, batch[i].user_data);
+            } else if (!batch[i].silent) {
+                posted++;
+            }
+        }
+        __atomic_sub_fetch(&ctx->active_requests, batch_size, __ATOMIC_RELAXED);
+        
+        pthread_mutex_lock(&g_bridge.lock);
+        g_bridge.stats.ai_optimized += optimized;
+        g_bridge.stats.windows_to_linux += batch_size;
+        pthread_mutex_unlock(&g_bridge.lock);
+        
+        /* Post completions; a full completion queue drops its oldest entries */
+        uint32_t overflows = 0;
+        pthread_mutex_lock(&qp->lock);
+        for (uint32_t i = 0; i < posted; i++) {
+            if (qp->cq_tail - qp->cq_head > qp->mask) {
+                qp->cq_head++;
+                overflows++;
+            }
+            qp->cq[qp->cq_tail & qp->mask] = completions[i];
+            qp->cq_tail++;
+        }
+        
+        /* Coalesced completion signal: one write until the queue is drained */
+        if (posted > 0 && qp->cq_event_fd >= 0 && !qp->cq_signaled) {
+            signal_event_fd(qp->cq_event_fd);
+            qp->cq_signaled = true;
+            signals++;
+        }
+        bool more = qp->sq_doorbell != qp->sq_head;
+        if (!more) {
+            qp->scheduled = false;
+        }
+        pthread_mutex_unlock(&qp->lock);
+        
         pthread_mutex_lock(&g_queue.lock);
+        g_queue.pending -= batch_size;
+        g_queue.inflight -= batch_size;
+        g_queue.cq_overflows += overflows;
+        g_queue.event_signals += signals;
+        g_pool.dequeued += batch_size;
+        g_pool.wait_ns += wait_ns;
+        g_pool.busy_ns += now_ns() - start;
         
-        /* Wait for requests or timeout */
-        struct timespec timeout;
-        clock_gettime(CLOCK_REALTIME, &timeout);
-        timeout.tv_nsec += g_bridge.config.batch_timeout_ms * 1000000;
-        if (timeout.tv_nsec >= 1000000000) {
-            timeout.tv_sec++;
-            timeout.tv_nsec -= 1000000000;
+        /* Requeue behind other pairs so one busy pair cannot starve them */
+        if (more) {
+            run_list_push(qp);
+        } else if (g_queue.drain_waiters > 0) {
+            g_queue.drains++;
+            pthread_cond_broadcast(&g_queue.drained);
+        }
+    }
+    
+    g_pool.workers[slot].exited = true;
+    g_pool.live--;
+    g_affinity.generation++;
+    pthread_mutex_unlock(&g_queue.lock);
+    
+    printf("[BRIDGE] Worker %u stopped\n", slot);
+    return NULL;
+}
+
+/* Helper: start a worker in a free slot (g_queue.lock held) */
+static int spawn_worker(void) {
+    for (uint32_t i = 0; i < BRIDGE_MAX_WORKERS; i++) {
+        if (g_pool.workers[i].active) {
+            continue;
         }
         
-        while (g_queue.count == 0 && g_bridge.worker_running) {
-            pthread_cond_timedwait(&g_queue.not_empty, &g_queue.lock, &timeout);
-            break; /* Process batch on timeout */
+        if (pthread_create(&g_pool.workers[i].thread, NULL, worker_thread_func,
+                           (void*)(uintptr_t)i) != 0) {
+            return BRIDGE_ERR_DEVICE;
         }
+        g_pool.workers[i].active = true;
+        g_pool.workers[i].exited = false;
+        g_pool.live++;
+        
+        /* Node shares depend on the worker count */
+        g_affinity.generation++;
+        wake_workers();
+        return BRIDGE_SUCCESS;
+    }
+    
+    return BRIDGE_ERR_NO_MEMORY;
+}
+
+/* Helper: record a scaling decision (g_queue.lock held) */
+static void record_scale_event(uint32_t old_workers, uint32_t new_workers,
+                               uint32_t depth, uint32_t wait_us, float utilization) {
+    bridge_scale_event_t *ev = &g_pool.history[g_pool.history_count % BRIDGE_SCALE_HISTORY];
+    ev->timestamp_ms = now_ns() / 1000000ULL;
+    ev->old_workers = old_workers;
+    ev->new_workers = new_workers;
+    ev->queue_depth = depth;
+    ev->avg_wait_us = wait_us;
+    ev->utilization = utilization;
+    g_pool.history_count++;
+    
+    if (new_workers > old_workers) {
+        g_pool.scale_ups++;
+    } else {
+        g_pool.scale_downs++;
+    }
+    
+    printf("[BRIDGE] Scaling workers %u -> %u (depth %u, wait %u us, util %.2f)\n",
+           old_workers, new_workers, depth, wait_us, utilization);
+}
+
+/* Scaler thread: grows and shrinks the worker pool with hysteresis */
+static void* scaler_thread_func(void *arg) {
+    (void)arg;
+    uint64_t last_dequeued = 0, last_wait_ns = 0, last_busy_ns = 0;
+    uint64_t last_sample = now_ns();
+    
+    pthread_mutex_lock(&g_queue.lock);
+    
+    while (g_bridge.worker_running) {
+        /* Work from a copy; the scaler must not stay pinned while it sleeps */
+        bridge_config_t config;
+        memcpy(&config, cfg_get(), sizeof(bridge_config_t));
+        cfg_put();
+        const bridge_config_t *c = &config;
+        
+        struct timespec timeout;
+        clock_gettime(CLOCK_REALTIME, &timeout);
+        timeout.tv_nsec += (long)c->batch_timeout_ms * 1000000L;
+        timeout.tv_sec += timeout.tv_nsec / 1000000000L;
+        timeout.tv_nsec %= 1000000000L;
+        pthread_cond_timedwait(&g_pool.scaler_cond, &g_queue.lock, &timeout);
         
         if (!g_bridge.worker_running) {
-            pthread_mutex_unlock(&g_queue.lock);
             break;
         }
+        memcpy(&config, cfg_get(), sizeof(bridge_config_t));
+        cfg_put();
         
-        /* Process batch of requests */
-        uint32_t batch_size = g_queue.count;
-        if (batch_size > 0) {
-            printf("[BRIDGE] Processing batch of %u requests\n", batch_size);
-            
-            for (uint32_t i = 0; i < batch_size; i++) {
-                uint32_t idx = g_queue.head;
-                comm_request_t *req = &g_queue.requests[idx];
-                device_context_t *ctx = g_queue.contexts[idx];
-                
-                /* Process request */
-                if (g_bridge.config.ai_enabled) {
-                    ai_prediction_t prediction;
-                    if (ai_buffer_process_request(req, &prediction) == AI_SUCCESS) {
-                        printf("[BRIDGE] AI decision: %d (confidence: %.2f)\n",
-                               prediction.decision, prediction.confidence);
-                        g_bridge.stats.ai_optimized++;
-                    }
+        /* Sample the period since the last wakeup */
+        uint64_t now = now_ns();
+        uint64_t period_ns = now - last_sample;
+        uint64_t dequeued = g_pool.dequeued - last_dequeued;
+        uint64_t wait_ns = g_pool.wait_ns - last_wait_ns;
+        uint64_t busy_ns = g_pool.busy_ns - last_busy_ns;
+        last_sample = now;
+        last_dequeued = g_pool.dequeued;
+        last_wait_ns = g_pool.wait_ns;
+        last_busy_ns = g_pool.busy_ns;
+        
+        uint32_t workers = g_pool.live - g_pool.retire;
+        uint32_t depth = g_queue.pending;
+        uint32_t wait_us = dequeued > 0 ? (uint32_t)(wait_ns / dequeued / 1000) : 0;
+        float util = (period_ns > 0 && workers > 0) ?
+                     (float)busy_ns / ((float)period_ns * workers) : 0.0f;
+        if (util > 1.0f) util = 1.0f;
+        g_pool.last_wait_us = wait_us;
+        g_pool.last_utilization = util;
+        
+        bool pressure = depth > c->scale_up_depth * workers ||
+                        wait_us > c->scale_up_wait_us ||
+                        util > BRIDGE_SCALE_UP_UTIL;
+        bool slack = depth == 0 && util < BRIDGE_SCALE_DOWN_UTIL;
+        
+        g_pool.up_streak = pressure ? g_pool.up_streak + 1 : 0;
+        g_pool.down_streak = slack ? g_pool.down_streak + 1 : 0;
+        
+        if (workers < c->min_workers || workers > c->max_workers) {
+            /* Bring the pool back inside reloaded bounds at once */
+            uint32_t target = workers < c->min_workers ? c->min_workers : c->max_workers;
+            uint32_t old_workers = workers;
+            while (workers < target) {
+                if (g_pool.retire > 0) {
+                    g_pool.retire--;
+                } else if (spawn_worker() != BRIDGE_SUCCESS) {
+                    break;
                 }
-                
-                /* Simulate forwarding to Linux kernel */
-                printf("[BRIDGE] Forward request type %d to Linux for device 0x%x\n",
-                       req->type, ctx->device_id);
-                
-                g_queue.head = (g_queue.head + 1) % 1024;
-                g_queue.count--;
-                g_bridge.stats.windows_to_linux++;
+                workers++;
+            }
+            if (workers > target) {
+                g_pool.retire += workers - target;
+                workers = target;
+                wake_workers();
+            }
+            if (workers != old_workers) {
+                record_scale_event(old_workers, workers, depth, wait_us, util);
+            }
+            g_pool.up_streak = 0;
+            g_pool.down_streak = 0;
+        } else if (g_pool.up_streak >= BRIDGE_SCALE_UP_SAMPLES &&
+                   workers < c->max_workers) {
+            if (g_pool.retire > 0) {
+                g_pool.retire--;    /* Cancel a pending retirement instead */
+                record_scale_event(workers, workers + 1, depth, wait_us, util);
+            } else if (spawn_worker() == BRIDGE_SUCCESS) {
+                record_scale_event(workers, workers + 1, depth, wait_us, util);
+            }
+            g_pool.up_streak = 0;
+        } else if (g_pool.down_streak >= BRIDGE_SCALE_DOWN_SAMPLES &&
+                   workers > c->min_workers) {
+            g_pool.retire++;
+            wake_workers();
+            record_scale_event(workers, workers - 1, depth, wait_us, util);
+            g_pool.down_streak = 0;
+        }
+        
+        /* Reap retired workers outside the lock */
+        pthread_t exited[BRIDGE_MAX_WORKERS];
+        uint32_t exited_count = 0;
+        for (uint32_t i = 0; i < BRIDGE_MAX_WORKERS; i++) {
+            if (g_pool.workers[i].active && g_pool.workers[i].exited) {
+                exited[exited_count++] = g_pool.workers[i].thread;
+                g_pool.workers[i].active = false;
+            }
+        }
+        if (exited_count > 0) {
+            pthread_mutex_unlock(&g_queue.lock);
+            for (uint32_t i = 0; i < exited_count; i++) {
+                pthread_join(exited[i], NULL);
+            }
+            pthread_mutex_lock(&g_queue.lock);
+        }
+        
+        /* Park while the pool is at its floor and nothing is happening */
+        if (g_pool.live == c->min_workers && g_pool.retire == 0 &&
+            g_queue.pending == 0 && dequeued == 0 && g_bridge.worker_running) {
+            g_pool.scaler_parked = true;
+            while (g_pool.scaler_parked && g_bridge.worker_running) {
+                pthread_cond_wait(&g_pool.scaler_cond, &g_queue.lock);
             }
+            last_sample = now_ns();
+        }
+    }
+    
+    pthread_mutex_unlock(&g_queue.lock);
+    return NULL;
+}
+
+/* Helper: free a device context and its queue pairs */
+static void free_device(device_context_t *ctx) {
+    if (ctx->backend && ctx->backend->detach) {
+        ctx->backend->detach(ctx, ctx->backend_state);
+    }
+    for (uint32_t q = 0; q < ctx->queue_count; q++) {
+        bridge_queue_pair_t *qp = ctx->queues[q];
+        pthread_mutex_destroy(&qp->lock);
+        if (qp->cq_event_fd >= 0) close(qp->cq_event_fd);
+        if (qp->sq_space_fd >= 0) close(qp->sq_space_fd);
+        free(qp->sq);
+        free(qp->cq);
+        free(qp);
+    }
+    free(ctx);
+}
+
+/* Helper: ring size rounded to whole pages, so a ring can move between nodes alone */
+static size_t ring_bytes(uint32_t depth, size_t entry_size) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return (depth * entry_size + page - 1) & ~(page - 1);
+}
+
+/* Helper: allocate a zeroed, page-aligned ring */
+static void* alloc_ring(uint32_t depth, size_t entry_size) {
+    void *ring = NULL;
+    size_t bytes = ring_bytes(depth, entry_size);
+    if (posix_memalign(&ring, (size_t)sysconf(_SC_PAGESIZE), bytes) != 0) {
+        return NULL;
+    }
+    memset(ring, 0, bytes);
+    return ring;
+}
+
+/* Helper: prefer a node for a ring's pages, moving those already there.
+ * Best effort: kernels without NUMA support refuse and nothing changes. */
+static void bind_ring(void *ring, uint32_t depth, size_t entry_size, int32_t node) {
+#ifdef SYS_mbind
+    unsigned long mask[BRIDGE_MAX_NODE_ID / (8 * sizeof(unsigned long))] = {0};
+    if (node < 0 || node >= BRIDGE_MAX_NODE_ID) {
+        return;
+    }
+    mask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+    syscall(SYS_mbind, ring, ring_bytes(depth, entry_size), BRIDGE_MPOL_PREFERRED,
+            mask, (unsigned long)BRIDGE_MAX_NODE_ID, BRIDGE_MPOL_MF_MOVE);
+#else
+    (void)ring;
+    (void)depth;
+    (void)entry_size;
+    (void)node;
+#endif
+}
+
+/* Helper: allocate a queue pair */
+static bridge_queue_pair_t* alloc_queue_pair(device_context_t *ctx, uint32_t qid) {
+    uint32_t depth = cfg_get()->queue_depth;
+    cfg_put();
+    
+    bridge_queue_pair_t *qp = (bridge_queue_pair_t*)calloc(1, sizeof(bridge_queue_pair_t));
+    if (!qp) {
+        return NULL;
+    }
+    
+    qp->sq = (bridge_sqe_t*)alloc_ring(depth, sizeof(bridge_sqe_t));
+    qp->cq = (bridge_completion_t*)alloc_ring(depth, sizeof(bridge_completion_t));
+    if (!qp->sq || !qp->cq) {
+        free(qp->sq);
+        free(qp->cq);
+        free(qp);
+        return NULL;
+    }
+    
+    qp->ctx = ctx;
+    qp->qid = qid;
+    qp->mask = depth - 1;
+    qp->cq_event_fd = -1;
+    qp->sq_space_fd = -1;
+    pthread_mutex_init(&qp->lock, NULL);
+    
+    return qp;
+}
+
+/* Helper: apply defaults and limits to a configuration */
+static void normalize_config(bridge_config_t *c) {
+    /* Worker pool defaults */
+    if (c->min_workers == 0) c->min_workers = 1;
+    if (c->min_workers > BRIDGE_MAX_WORKERS) c->min_workers = BRIDGE_MAX_WORKERS;
+    if (c->max_workers < c->min_workers) c->max_workers = c->min_workers;
+    if (c->max_workers > BRIDGE_MAX_WORKERS) c->max_workers = BRIDGE_MAX_WORKERS;
+    if (c->batch_timeout_ms == 0) c->batch_timeout_ms = 10;
+    if (c->scale_up_depth == 0) c->scale_up_depth = 32;
+    if (c->scale_up_wait_us == 0) c->scale_up_wait_us = 1000;
+    
+    /* Queue pair defaults; depth is rounded up to a power of two */
+    if (c->queues_per_device == 0) c->queues_per_device = 1;
+    if (c->queues_per_device > BRIDGE_MAX_QUEUES) c->queues_per_device = BRIDGE_MAX_QUEUES;
+    if (c->queue_depth == 0) c->queue_depth = 256;
+    uint32_t depth = 16;
+    while (depth < c->queue_depth && depth < 65536) {
+        depth <<= 1;
+    }
+    c->queue_depth = depth;
+    
+    if (c->sync_timeout_us == 0) c->sync_timeout_us = 100000;
+    
+    /* Rate limit burst */
+    if (c->rate_limit_rps > 0 && c->rate_limit_burst == 0) {
+        c->rate_limit_burst = c->rate_limit_rps / 10 > 0 ? c->rate_limit_rps / 10 : 1;
+    }
+}
+
+/* Helper: start the AI buffer the first time a config enables it */
+static int start_ai(const bridge_config_t *c) {
+    if (!c->ai_enabled || g_bridge.ai_started) {
+        return BRIDGE_SUCCESS;
+    }
+    
+    if (ai_buffer_init(c->mode == BRIDGE_MODE_LEARNING) != AI_SUCCESS) {
+        fprintf(stderr, "[BRIDGE] Failed to initialize AI buffer\n");
+        return BRIDGE_ERR_AI_FAILURE;
+    }
+    g_bridge.ai_started = true;
+    printf("[BRIDGE] AI buffer initialized in %s mode\n",
+           c->mode == BRIDGE_MODE_LEARNING ? "learning" : "inference");
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Helper: publish a new snapshot (g_bridge.config_lock held) */
+static int publish_config(const bridge_config_t *config) {
+    bridge_config_snapshot_t *old = g_bridge.config;
+    
+    bridge_config_snapshot_t *snap =
+        (bridge_config_snapshot_t*)calloc(1, sizeof(bridge_config_snapshot_t));
+    if (!snap) {
+        return BRIDGE_ERR_NO_MEMORY;
+    }
+    memcpy(&snap->config, config, sizeof(bridge_config_t));
+    normalize_config(&snap->config);
+    
+    int ret = start_ai(&snap->config);
+    if (ret != BRIDGE_SUCCESS) {
+        free(snap);
+        return ret;
+    }
+    
+    snap->version = old ? old->version + 1 : 1;
+    snap->retired = old;
+    __atomic_store_n(&g_bridge.config, snap, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&g_bridge.config_epoch, snap->version, __ATOMIC_SEQ_CST);
+    if (old) {
+        __atomic_store_n(&g_bridge.config_retired, true, __ATOMIC_RELEASE);
+        reclaim_config();
+    }
+    
+    /* Let the scaler apply new worker bounds and batch window now */
+    if (old) {
+        pthread_mutex_lock(&g_queue.lock);
+        g_pool.scaler_parked = false;
+        pthread_cond_signal(&g_pool.scaler_cond);
+        pthread_mutex_unlock(&g_queue.lock);
+        
+        printf("[BRIDGE] Config v%lu applied (mode %d, AI %s, %u-%u workers, "
+               "batch %u ms, cap %u, rate %u/s)\n",
+               snap->version, snap->config.mode, snap->config.ai_enabled ? "on" : "off",
+               snap->config.min_workers, snap->config.max_workers,
+               snap->config.batch_timeout_ms, snap->config.max_pending_requests,
+               snap->config.rate_limit_rps);
+    }
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Initialize bridge */
+int bridge_init(const bridge_config_t *config) {
+    if (g_bridge.initialized) {
+        return BRIDGE_SUCCESS;
+    }
+    
+    if (!config) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
+    
+    /* Initialize statistics */
+    memset(&g_bridge.stats, 0, sizeof(bridge_stats_t));
+    memset(&g_pool, 0, sizeof(g_pool));
+    
+    /* Initialize locks */
+    pthread_mutex_init(&g_bridge.lock, NULL);
+    pthread_mutex_init(&g_bridge.config_lock, NULL);
+    pthread_mutex_init(&g_queue.lock, NULL);
+    pthread_cond_init(&g_queue.not_empty, NULL);
+    pthread_cond_init(&g_queue.drained, NULL);
+    pthread_cond_init(&g_pool.scaler_cond, NULL);
+    
+    /* Initialize run list */
+    g_queue.head = NULL;
+    g_queue.tail = NULL;
+    g_queue.pending = 0;
+    g_queue.doorbells = 0;
+    g_queue.cq_overflows = 0;
+    g_queue.event_signals = 0;
+    g_queue.inflight = 0;
+    g_queue.tokens = 0.0;
+    g_queue.refill_ns = 0;
+    g_queue.rate_limited = 0;
+    
+    memset(&g_sync, 0, sizeof(g_sync));
+    g_sync.spin_enabled = sysconf(_SC_NPROCESSORS_ONLN) > 1;
+    
+    /* Nodes are learned as devices report them */
+    memset(&g_affinity, 0, sizeof(g_affinity));
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &g_affinity.process_cpus) != 0) {
+        for (long cpu = 0; cpu < sysconf(_SC_NPROCESSORS_CONF) && cpu < CPU_SETSIZE; cpu++) {
+            CPU_SET(cpu, &g_affinity.process_cpus);
+        }
+    }
+    g_sync.hist.min_ns = UINT64_MAX;
+    
+    /* Publish the first configuration snapshot (starts the AI buffer if enabled) */
+    g_bridge.config = NULL;
+    g_bridge.config_epoch = 0;
+    g_bridge.config_readers = 0;
+    g_bridge.config_retired = false;
+    g_bridge.config_reclaimed = 0;
+    g_bridge.ai_started = false;
+    int ret = publish_config(config);
+    if (ret != BRIDGE_SUCCESS) {
+        return ret;
+    }
+    const bridge_config_t *c = cfg();
+    
+    /* Start the worker pool at its floor, plus the scaler */
+    g_bridge.worker_running = true;
+    pthread_mutex_lock(&g_queue.lock);
+    for (uint32_t i = 0; i < c->min_workers; i++) {
+        if (spawn_worker() != BRIDGE_SUCCESS) {
+            pthread_mutex_unlock(&g_queue.lock);
+            fprintf(stderr, "[BRIDGE] Failed to create worker thread\n");
+            return BRIDGE_ERR_DEVICE;
+        }
+    }
+    pthread_mutex_unlock(&g_queue.lock);
+    
+    if (pthread_create(&g_pool.scaler_thread, NULL, scaler_thread_func, NULL) != 0) {
+        fprintf(stderr, "[BRIDGE] Failed to create scaler thread\n");
+        return BRIDGE_ERR_DEVICE;
+    }
+    
+    g_bridge.initialized = true;
+    printf("[BRIDGE] Initialized in mode %d for chipset type %d "
+           "(%u-%u workers, %u x %u queue pairs per device)\n",
+           c->mode, c->chipset_type, c->min_workers, c->max_workers,
+           c->queues_per_device, c->queue_depth);
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Helper: stop the config watcher thread */
+static void stop_config_watch(void) {
+    if (!g_watch.running) {
+        return;
+    }
+    
+    /* Requests see -1 from here; wait out any still writing before closing */
+    __atomic_store_n(&g_watch.signal_fd, -1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&g_watch.signalers, __ATOMIC_SEQ_CST) != 0) {
+        cpu_relax();
+    }
+    
+    g_watch.running = false;
+    uint64_t one = 1;
+    if (write(g_watch.wake_fd, &one, sizeof(one)) < 0) {
+        /* Counter saturated; the watcher wakes anyway */
+    }
+    pthread_join(g_watch.thread, NULL);
+    
+    close(g_watch.inotify_fd);
+    close(g_watch.wake_fd);
+    g_watch.inotify_fd = -1;
+    g_watch.wake_fd = -1;
+}
+
+/* Shutdown bridge */
+void bridge_shutdown(void) {
+    if (!g_bridge.initialized) {
+        return;
+    }
+    
+    printf("[BRIDGE] Shutting down...\n");
+    
+    stop_config_watch();
+    
+    /* Stop scaler and worker threads */
+    pthread_mutex_lock(&g_queue.lock);
+    g_bridge.worker_running = false;
+    g_pool.scaler_parked = false;
+    wake_workers();
+    pthread_cond_broadcast(&g_queue.drained);
+    pthread_cond_signal(&g_pool.scaler_cond);
+    pthread_mutex_unlock(&g_queue.lock);
+    
+    pthread_join(g_pool.scaler_thread, NULL);
+    for (uint32_t i = 0; i < BRIDGE_MAX_WORKERS; i++) {
+        if (g_pool.workers[i].active) {
+            pthread_join(g_pool.workers[i].thread, NULL);
+            g_pool.workers[i].active = false;
+        }
+    }
+    
+    /* Shutdown AI buffer */
+    if (g_bridge.ai_started) {
+        ai_buffer_shutdown();
+        g_bridge.ai_started = false;
+    }
+    
+    /* Cleanup devices */
+    pthread_mutex_lock(&g_bridge.lock);
+    for (uint32_t i = 0; i < g_bridge.device_count; i++) {
+        if (g_bridge.devices[i]) {
+            free_device(g_bridge.devices[i]);
+            g_bridge.devices[i] = NULL;
+        }
+    }
+    g_bridge.device_count = 0;
+    pthread_mutex_unlock(&g_bridge.lock);
+    
+    /* Free current and retired configuration snapshots */
+    bridge_config_snapshot_t *snap = g_bridge.config;
+    while (snap) {
+        bridge_config_snapshot_t *retired = snap->retired;
+        free(snap);
+        snap = retired;
+    }
+    g_bridge.config = NULL;
+    
+    /* Destroy locks */
+    pthread_mutex_destroy(&g_bridge.lock);
+    pthread_mutex_destroy(&g_bridge.config_lock);
+    pthread_mutex_destroy(&g_queue.lock);
+    pthread_cond_destroy(&g_queue.not_empty);
+    pthread_cond_destroy(&g_queue.drained);
+    pthread_cond_destroy(&g_pool.scaler_cond);
+    for (uint32_t n = 0; n < g_affinity.node_count; n++) {
+        pthread_cond_destroy(&g_affinity.nodes[n].wake);
+    }
+    g_affinity.node_count = 0;
+    
+    g_bridge.backend = NULL;
+    g_bridge.initialized = false;
+    printf("[BRIDGE] Shutdown complete\n");
+}
+
+/* Register device */
+device_context_t* bridge_register_device(uint32_t device_id,
+                                         chipset_type_t chipset_type,
+                                         void *windows_device,
+                                         void *linux_device) {
+    if (!g_bridge.initialized) {
+        return NULL;
+    }
+    
+    pthread_mutex_lock(&g_bridge.lock);
+    
+    if (g_bridge.device_count >= 256) {
+        pthread_mutex_unlock(&g_bridge.lock);
+        return NULL;
+    }
+    
+    /* Allocate device context */
+    device_context_t *ctx = (device_context_t*)calloc(1, sizeof(device_context_t));
+    if (!ctx) {
+        pthread_mutex_unlock(&g_bridge.lock);
+        return NULL;
+    }
+    
+    /* Initialize context */
+    ctx->device_id = device_id;
+    ctx->chipset_type = chipset_type;
+    ctx->windows_device_object = windows_device;
+    ctx->linux_device_handle = linux_device;
+    ctx->ai_managed = cfg_get()->ai_enabled;
+    cfg_put();
+    ctx->active_requests = 0;
+    ctx->numa_node = -1;
+    
+    /* Bind the backend before any request can reach the device */
+    const bridge_backend_t *backend = g_bridge.backend;
+    if (backend) {
+        void *state = backend->attach ? backend->attach(ctx) : NULL;
+        if (backend->attach && !state) {
+            free(ctx);
+            pthread_mutex_unlock(&g_bridge.lock);
+            return NULL;
+        }
+        ctx->backend = backend;
+        ctx->backend_state = state;
+    }
+    
+    /* Allocate queue pairs */
+    uint32_t queues = cfg_get()->queues_per_device;
+    cfg_put();
+    for (uint32_t q = 0; q < queues; q++) {
+        ctx->queues[q] = alloc_queue_pair(ctx, q);
+        if (!ctx->queues[q]) {
+            free_device(ctx);
+            pthread_mutex_unlock(&g_bridge.lock);
+            return NULL;
+        }
+        ctx->queue_count++;
+    }
+    
+    /* Add to device list */
+    g_bridge.devices[g_bridge.device_count++] = ctx;
+    
+    pthread_mutex_unlock(&g_bridge.lock);
+    
+    printf("[BRIDGE] Registered device 0x%x (chipset type %d, %u queue pairs, %s backend)\n",
+           device_id, chipset_type, ctx->queue_count,
+           ctx->backend ? ctx->backend->name : "simulated");
+    
+    return ctx;
+}
+
+/* Helper: parse a sysfs CPU list such as "0-7,16-23" */
+static bool parse_cpulist(const char *list, cpu_set_t *cpus) {
+    CPU_ZERO(cpus);
+    
+    const char *p = list;
+    while (*p != '\0' && *p != '\n') {
+        char *end;
+        unsigned long first = strtoul(p, &end, 10);
+        unsigned long last = first;
+        if (end == p) {
+            return false;
+        }
+        if (*end == '-') {
+            p = end + 1;
+            last = strtoul(p, &end, 10);
+            if (end == p || last < first) {
+                return false;
+            }
+        }
+        for (unsigned long cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+            CPU_SET(cpu, cpus);
+        }
+        p = *end == ',' ? end + 1 : end;
+    }
+    
+    return CPU_COUNT(cpus) > 0;
+}
+
+/* Set device affinity */
+int bridge_set_device_affinity(device_context_t *ctx, int32_t numa_node, const char *cpulist) {
+    if (!g_bridge.initialized) {
+        return BRIDGE_ERR_NOT_INIT;
+    }
+    
+    cpu_set_t cpus;
+    if (!ctx || numa_node < 0 || numa_node >= BRIDGE_MAX_NODE_ID || !cpulist ||
+        !parse_cpulist(cpulist, &cpus)) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
+    
+    /* Only CPUs this process may run on; a restricted process may have none there */
+    CPU_AND(&cpus, &cpus, &g_affinity.process_cpus);
+    
+    int ret = BRIDGE_SUCCESS;
+    pthread_mutex_lock(&g_queue.lock);
+    ctx->numa_node = numa_node;
+    
+    uint32_t n = 0;
+    while (n < g_affinity.node_count && g_affinity.nodes[n].node != numa_node) {
+        n++;
+    }
+    if (n == g_affinity.node_count && CPU_COUNT(&cpus) > 0) {
+        if (n < BRIDGE_MAX_NODES) {
+            g_affinity.nodes[n].node = numa_node;
+            g_affinity.nodes[n].cpus = cpus;
+            pthread_cond_init(&g_affinity.nodes[n].wake, NULL);
+            g_affinity.node_count++;
+            g_affinity.generation++;
+            wake_workers();
+        } else {
+            ret = BRIDGE_ERR_NO_MEMORY;
+        }
+    }
+    pthread_mutex_unlock(&g_queue.lock);
+    
+    /* Rings live on the device's node; the kernel migrates the pages */
+    for (uint32_t q = 0; q < ctx->queue_count; q++) {
+        bridge_queue_pair_t *qp = ctx->queues[q];
+        uint32_t depth = qp->mask + 1;
+        bind_ring(qp->sq, depth, sizeof(bridge_sqe_t), numa_node);
+        bind_ring(qp->cq, depth, sizeof(bridge_completion_t), numa_node);
+    }
+    
+    printf("[BRIDGE] Device 0x%x on NUMA node %d (CPUs %.*s)\n", ctx->device_id, numa_node,
+           (int)strcspn(cpulist, "\n"), cpulist);
+    
+    return ret;
+}
+
+/* Unregister device */
+void bridge_unregister_device(device_context_t *ctx) {
+    if (!g_bridge.initialized || !ctx) {
+        return;
+    }
+    
+    pthread_mutex_lock(&g_bridge.lock);
+    
+    /* Find and remove device */
+    for (uint32_t i = 0; i < g_bridge.device_count; i++) {
+        if (g_bridge.devices[i] == ctx) {
+            /* Shift remaining devices */
+            for (uint32_t j = i; j < g_bridge.device_count - 1; j++) {
+                g_bridge.devices[j] = g_bridge.devices[j + 1];
+            }
+            g_bridge.devices[--g_bridge.device_count] = NULL;
+            break;
+        }
+    }
+    
+    pthread_mutex_unlock(&g_bridge.lock);
+    
+    /* Let the workers drain anything still queued for this device */
+    bridge_ring_doorbell(ctx);
+    pthread_mutex_lock(&g_queue.lock);
+    g_queue.drain_waiters++;
+    for (uint32_t q = 0; q < ctx->queue_count && g_bridge.worker_running; q++) {
+        bridge_queue_pair_t *qp = ctx->queues[q];
+        for (;;) {
+            /* Sampled first: a pair going idle after the check still wakes us */
+            uint64_t drains = g_queue.drains;
+            pthread_mutex_unlock(&g_queue.lock);
+            pthread_mutex_lock(&qp->lock);
+            bool idle = !qp->scheduled && qp->sq_head == qp->sq_tail;
+            pthread_mutex_unlock(&qp->lock);
+            pthread_mutex_lock(&g_queue.lock);
+            if (idle) {
+                break;
+            }
+            while (drains == g_queue.drains && g_bridge.worker_running) {
+                pthread_cond_wait(&g_queue.drained, &g_queue.lock);
+            }
+            if (!g_bridge.worker_running) {
+                break;
+            }
+        }
+    }
+    g_queue.drain_waiters--;
+    pthread_mutex_unlock(&g_queue.lock);
+    
+    printf("[BRIDGE] Unregistered device 0x%x\n", ctx->device_id);
+    free_device(ctx);
+}
+
+/* Helper: pick the calling thread's queue pair. Each submitting thread
+ * keeps the same pair, so its requests are executed in program order. */
+static bridge_queue_pair_t* select_queue(device_context_t *ctx) {
+    if (tls_queue_hint == UINT32_MAX) {
+        tls_queue_hint = __atomic_fetch_add(&g_queue_hint_next, 1, __ATOMIC_RELAXED);
+    }
+    return ctx->queues[tls_queue_hint % ctx->queue_count];
+}
+
+/* Helper: copy requests into a submission queue (qp->lock held) */
+static int sq_push(bridge_queue_pair_t *qp, const comm_request_t *requests, uint32_t count,
+                   bridge_completion_fn callback, void *user_data,
+                   const bridge_config_t *c) {
+    if (count > qp->mask + 1 - (qp->sq_tail - qp->sq_head)) {
+        return BRIDGE_ERR_TIMEOUT;
+    }
+    
+    uint64_t now = now_ns();
+    for (uint32_t i = 0; i < count; i++) {
+        bridge_sqe_t *sqe = &qp->sq[qp->sq_tail & qp->mask];
+        memcpy(&sqe->req, &requests[i], sizeof(comm_request_t));
+        sqe->enqueue_ns = now;
+        
+        /* A callback batch completes once, on its last entry */
+        bool last = i == count - 1;
+        sqe->callback = last ? callback : NULL;
+        sqe->user_data = user_data;
+        sqe->silent = callback && !last;
+        if (sqe->req.type < REQ_UNKNOWN && c->type_priority[sqe->req.type] != 0) {
+            sqe->req.priority = c->type_priority[sqe->req.type];
+        }
+        
+        /* Small write payloads are copied so callers may reuse their buffers */
+        sqe->data_inline = requests[i].type == REQ_IO_WRITE && requests[i].data &&
+                           requests[i].sg_count == 0 && requests[i].size <= BRIDGE_INLINE_DATA;
+        if (sqe->data_inline) {
+            memcpy(sqe->inline_data, requests[i].data, requests[i].size);
+        }
+        qp->sq_tail++;
+    }
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Helper: announce a queue pair's new entries (takes qp->lock) */
+static uint32_t sq_doorbell(bridge_queue_pair_t *qp) {
+    pthread_mutex_lock(&qp->lock);
+    
+    uint32_t announced = qp->sq_tail - qp->sq_doorbell;
+    if (announced == 0) {
+        pthread_mutex_unlock(&qp->lock);
+        return 0;
+    }
+    qp->sq_doorbell = qp->sq_tail;
+    
+    bool schedule = !qp->scheduled;
+    qp->scheduled = true;
+    
+    pthread_mutex_lock(&g_queue.lock);
+    g_queue.pending += announced;
+    g_queue.doorbells++;
+    if (schedule) {
+        run_list_push(qp);
+    }
+    pthread_mutex_unlock(&g_queue.lock);
+    
+    pthread_mutex_unlock(&qp->lock);
+    
+    return announced;
+}
+
+/* Helper: admit requests against the queue cap and rate limit (g_queue.lock held) */
+static int admit_requests(const bridge_config_t *c, uint32_t count) {
+    if (c->max_pending_requests > 0 &&
+        g_queue.inflight + count > c->max_pending_requests) {
+        g_bridge.stats.failures += count;
+        return BRIDGE_ERR_TIMEOUT;
+    }
+    
+    if (c->rate_limit_rps > 0) {
+        /* Token bucket; a batch larger than the bucket may borrow */
+        uint64_t now = now_ns();
+        double burst = (double)c->rate_limit_burst;
+        g_queue.tokens += (double)(now - g_queue.refill_ns) * c->rate_limit_rps / 1e9;
+        if (g_queue.tokens > burst) {
+            g_queue.tokens = burst;
+        }
+        g_queue.refill_ns = now;
+        
+        double need = count < burst ? (double)count : burst;
+        if (g_queue.tokens < need) {
+            g_queue.rate_limited += count;
+            return BRIDGE_ERR_RATE_LIMITED;
+        }
+        g_queue.tokens -= count;
+    }
+    
+    g_queue.inflight += count;
+    return BRIDGE_SUCCESS;
+}
+
+/* Helper: queue requests on the caller's queue pair */
+static int queue_requests(device_context_t *ctx, const comm_request_t *requests,
+                          uint32_t count, bridge_completion_fn callback, void *user_data,
+                          bridge_queue_pair_t **out_qp) {
+    const bridge_config_t *c = cfg_get();
+    bridge_queue_pair_t *qp = select_queue(ctx);
+    
+    pthread_mutex_lock(&g_queue.lock);
+    g_bridge.stats.total_requests += count;
+    int ret = admit_requests(c, count);
+    pthread_mutex_unlock(&g_queue.lock);
+    
+    if (ret != BRIDGE_SUCCESS) {
+        cfg_put();
+        return ret;
+    }
+    
+    pthread_mutex_lock(&qp->lock);
+    ret = sq_push(qp, requests, count, callback, user_data, c);
+    if (ret != BRIDGE_SUCCESS) {
+        qp->space_wanted = true;
+    } else if (qp->space_signaled) {
+        drain_event_fd(qp->sq_space_fd);
+        qp->space_signaled = false;
+    }
+    pthread_mutex_unlock(&qp->lock);
+    cfg_put();
+    
+    if (ret != BRIDGE_SUCCESS) {
+        pthread_mutex_lock(&g_queue.lock);
+        g_queue.inflight -= count;
+        g_bridge.stats.failures += count;
+        pthread_mutex_unlock(&g_queue.lock);
+        return ret;
+    }
+    
+    __atomic_add_fetch(&ctx->active_requests, count, __ATOMIC_RELAXED);
+    *out_qp = qp;
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Forward request */
+int bridge_forward_request(device_context_t *ctx, const comm_request_t *request) {
+    return bridge_submit_batch(ctx, request, 1);
+}
+
+/* Submit a batch with a single doorbell */
+int bridge_submit_batch(device_context_t *ctx, const comm_request_t *requests,
+                        uint32_t count) {
+    if (!g_bridge.initialized || !ctx || !requests || count == 0) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
+    
+    bridge_queue_pair_t *qp;
+    int ret = queue_requests(ctx, requests, count, NULL, NULL, &qp);
+    if (ret != BRIDGE_SUCCESS) {
+        return ret;
+    }
+    
+    sq_doorbell(qp);
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Submit with completion callback */
+int bridge_submit_async(device_context_t *ctx, const comm_request_t *request,
+                        bridge_completion_fn callback, void *user_data) {
+    return bridge_submit_batch_async(ctx, request, 1, callback, user_data);
+}
+
+/* Submit a batch with one completion callback */
+int bridge_submit_batch_async(device_context_t *ctx, const comm_request_t *requests,
+                              uint32_t count, bridge_completion_fn callback,
+                              void *user_data) {
+    if (!g_bridge.initialized || !ctx || !requests || count == 0 || !callback) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
+    
+    bridge_queue_pair_t *qp;
+    int ret = queue_requests(ctx, requests, count, callback, user_data, &qp);
+    if (ret != BRIDGE_SUCCESS) {
+        return ret;
+    }
+    
+    sq_doorbell(qp);
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Helper: futex syscall */
+static long futex(uint32_t *uaddr, int op, uint32_t val, const struct timespec *timeout) {
+    return syscall(SYS_futex, uaddr, op, val, timeout, NULL, 0);
+}
+
+/* Create future */
+bridge_future_t* bridge_future_create(void) {
+    bridge_future_t *future = (bridge_future_t*)calloc(1, sizeof(bridge_future_t));
+    if (future) {
+        future->refs = 1;
+        future->state = FUTURE_DONE;
+    }
+    return future;
+}
+
+/* Release future */
+void bridge_future_release(bridge_future_t *future) {
+    if (!future) {
+        return;
+    }
+    
+    uint32_t left = __atomic_sub_fetch(&future->refs, 1, __ATOMIC_ACQ_REL);
+    if (left == 0) {
+        free(future->buffer);
+        free(future);
+    } else if (left == (1 | FUTURE_REFS_WAITER)) {
+        /* The owner is waiting to reuse it; the wake only uses the address */
+        __atomic_store_n(&future->refs, 1, __ATOMIC_RELEASE);
+        futex(&future->refs, FUTEX_WAKE_PRIVATE, 1, NULL);
+    }
+}
+
+/* Get future scratch buffer */
+void* bridge_future_buffer(bridge_future_t *future, size_t size) {
+    if (!future) {
+        return NULL;
+    }
+    
+    if (size > future->buffer_size) {
+        void *buffer = realloc(future->buffer, size);
+        if (!buffer) {
+            return NULL;
+        }
+        future->buffer = buffer;
+        future->buffer_size = size;
+    }
+    
+    return future->buffer;
+}
+
+/* Helper: complete a future from a worker */
+static void future_complete(device_context_t *ctx, const bridge_completion_t *completion,
+                            void *user_data) {
+    (void)ctx;
+    bridge_future_t *future = (bridge_future_t*)user_data;
+    
+    future->completion = *completion;
+    if (__atomic_exchange_n(&future->state, FUTURE_DONE, __ATOMIC_RELEASE) == FUTURE_SLEEPING) {
+        futex(&future->state, FUTEX_WAKE_PRIVATE, 1, NULL);
+    }
+    bridge_future_release(future);
+}
+
+/* Submit with future */
+int bridge_submit_future(device_context_t *ctx, const comm_request_t *request,
+                         bridge_future_t *future) {
+    return bridge_submit_batch_future(ctx, request, 1, future);
+}
+
+/* Submit batch with future */
+int bridge_submit_batch_future(device_context_t *ctx, const comm_request_t *requests,
+                               uint32_t count, bridge_future_t *future) {
+    if (!g_bridge.initialized || !ctx || !requests || count == 0 || !future) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
+    
+    /* The previous completer may still be dropping its reference; sleep
+     * on the count until it has */
+    uint32_t refs = __atomic_load_n(&future->refs, __ATOMIC_ACQUIRE);
+    while (refs != 1) {
+        if (!(refs & FUTURE_REFS_WAITER) &&
+            !__atomic_compare_exchange_n(&future->refs, &refs, refs | FUTURE_REFS_WAITER,
+                                         false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+        futex(&future->refs, FUTEX_WAIT_PRIVATE, refs | FUTURE_REFS_WAITER, NULL);
+        refs = __atomic_load_n(&future->refs, __ATOMIC_ACQUIRE);
+    }
+    
+    future->state = FUTURE_PENDING;
+    future->refs = 2;
+    future->submit_ns = now_ns();
+    future->round_trip = count == 1 && requests[0].type == REQ_IO_READ &&
+                         !requests[0].sg && requests[0].size <= sizeof(uint64_t);
+    
+    bridge_queue_pair_t *qp;
+    int ret = queue_requests(ctx, requests, count, future_complete, future, &qp);
+    if (ret != BRIDGE_SUCCESS) {
+        future->refs = 1;
+        future->state = FUTURE_DONE;
+        return ret;
+    }
+    
+    sq_doorbell(qp);
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Helper: record a synchronous round trip */
+static void record_round_trip(uint64_t rtt_ns) {
+    uint32_t bucket = 0;
+    while (bucket < BRIDGE_LATENCY_BUCKETS - 1 && (rtt_ns >> (bucket + 1)) != 0) {
+        bucket++;
+    }
+    __atomic_add_fetch(&g_sync.hist.buckets[bucket], 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_sync.hist.count, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_sync.hist.total_ns, rtt_ns, __ATOMIC_RELAXED);
+    
+    uint64_t seen = __atomic_load_n(&g_sync.hist.min_ns, __ATOMIC_RELAXED);
+    while (rtt_ns < seen && !__atomic_compare_exchange_n(&g_sync.hist.min_ns, &seen, rtt_ns,
+                                                         true, __ATOMIC_RELAXED,
+                                                         __ATOMIC_RELAXED)) {
+    }
+    seen = __atomic_load_n(&g_sync.hist.max_ns, __ATOMIC_RELAXED);
+    while (rtt_ns > seen && !__atomic_compare_exchange_n(&g_sync.hist.max_ns, &seen, rtt_ns,
+                                                         true, __ATOMIC_RELAXED,
+                                                         __ATOMIC_RELAXED)) {
+    }
+    
+    /* EWMA (1/8) steers how long the next waiter spins */
+    uint64_t ewma = __atomic_load_n(&g_sync.rtt_ewma_ns, __ATOMIC_RELAXED);
+    ewma = ewma == 0 ? rtt_ns : ewma - ewma / 8 + rtt_ns / 8;
+    __atomic_store_n(&g_sync.rtt_ewma_ns, ewma, __ATOMIC_RELAXED);
+}
+
+/* Wait for future */
+int bridge_future_wait(bridge_future_t *future, uint32_t timeout_us,
+                       bridge_completion_t *completion) {
+    if (!g_bridge.initialized) {
+        return BRIDGE_ERR_NOT_INIT;
+    }
+    
+    if (!future) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
+    
+    if (timeout_us == 0) {
+        timeout_us = cfg_get()->sync_timeout_us;
+        cfg_put();
+    }
+    uint64_t start = now_ns();
+    uint64_t deadline = start + (uint64_t)timeout_us * 1000ULL;
+    
+    /* Spin for about two recent round trips when those were short */
+    uint64_t ewma = __atomic_load_n(&g_sync.rtt_ewma_ns, __ATOMIC_RELAXED);
+    uint64_t spin_ns = (g_sync.spin_enabled && ewma <= BRIDGE_SPIN_MAX_NS) ? ewma * 2 : 0;
+    if (spin_ns > BRIDGE_SPIN_MAX_NS) {
+        spin_ns = BRIDGE_SPIN_MAX_NS;
+    }
+    uint32_t state = __atomic_load_n(&future->state, __ATOMIC_ACQUIRE);
+    bool spun = false;
+    for (uint32_t i = 0; spin_ns > 0 && state != FUTURE_DONE; i++) {
+        if ((i & 63) == 63 && now_ns() - start >= spin_ns) {
+            break;
+        }
+        cpu_relax();
+        state = __atomic_load_n(&future->state, __ATOMIC_ACQUIRE);
+        spun = true;
+    }
+    
+    /* A hit is a completion the spin caught, not one already there */
+    if (state == FUTURE_DONE) {
+        if (spun) {
+            __atomic_add_fetch(&g_sync.spin_hits, 1, __ATOMIC_RELAXED);
+        }
+    } else {
+        __atomic_add_fetch(&g_sync.sleeps, 1, __ATOMIC_RELAXED);
+        
+        /* Announce the sleeper, then block until the worker wakes us */
+        while (state != FUTURE_DONE) {
+            if (state == FUTURE_PENDING &&
+                !__atomic_compare_exchange_n(&future->state, &state, FUTURE_SLEEPING, false,
+                                             __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+                continue;
+            }
+            
+            uint64_t now = now_ns();
+            if (now >= deadline) {
+                __atomic_add_fetch(&g_sync.timeouts, 1, __ATOMIC_RELAXED);
+                return BRIDGE_ERR_TIMEOUT;
+            }
+            
+            struct timespec remaining = {
+                .tv_sec = (time_t)((deadline - now) / 1000000000ULL),
+                .tv_nsec = (long)((deadline - now) % 1000000000ULL)
+            };
+            futex(&future->state, FUTEX_WAIT_PRIVATE, FUTURE_SLEEPING, &remaining);
+            state = __atomic_load_n(&future->state, __ATOMIC_ACQUIRE);
+        }
+    }
+    
+    if (future->round_trip) {
+        record_round_trip(now_ns() - future->submit_ns);
+    }
+    
+    if (completion) {
+        *completion = future->completion;
+    }
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Get sync latency histogram */
+int bridge_get_sync_latency(bridge_latency_hist_t *hist) {
+    if (!g_bridge.initialized) {
+        return BRIDGE_ERR_NOT_INIT;
+    }
+    
+    if (!hist) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
+    
+    for (int i = 0; i < BRIDGE_LATENCY_BUCKETS; i++) {
+        hist->buckets[i] = __atomic_load_n(&g_sync.hist.buckets[i], __ATOMIC_RELAXED);
+    }
+    hist->count = __atomic_load_n(&g_sync.hist.count, __ATOMIC_RELAXED);
+    hist->total_ns = __atomic_load_n(&g_sync.hist.total_ns, __ATOMIC_RELAXED);
+    hist->min_ns = hist->count > 0 ? __atomic_load_n(&g_sync.hist.min_ns, __ATOMIC_RELAXED) : 0;
+    hist->max_ns = __atomic_load_n(&g_sync.hist.max_ns, __ATOMIC_RELAXED);
+    
+    return BRIDGE_SUCCESS;
+}
+
+/* Percentile from histogram */
+uint64_t bridge_latency_percentile(const bridge_latency_hist_t *hist, float percentile) {
+    if (!hist || hist->count == 0) {
+        return 0;
+    }
+    
+    uint64_t target = (uint64_t)((double)hist->count * percentile / 100.0);
+    if (target >= hist->count) {
+        target = hist->count - 1;
+    }
+    
+    uint64_t seen = 0;
+    for (int i = 0; i < BRIDGE_LATENCY_BUCKETS; i++) {
+        seen += hist->buckets[i];
+        if (seen > target) {
+            return 2ULL << i;
         }
-        
-        pthread_mutex_unlock(&g_queue.lock);
-        
-        usleep(1000); /* 1ms sleep */
     }
     
-    printf("[BRIDGE] Worker thread stopped\n");
-    return NULL;
+    return hist->max_ns;
 }
 
-/* Initialize bridge */
-int bridge_init(const bridge_config_t *config) {
-    if (g_bridge.initialized) {
-        return BRIDGE_SUCCESS;
+/* Queue without doorbell */
+int bridge_queue_request(device_context_t *ctx, const comm_request_t *request) {
+    if (!g_bridge.initialized || !ctx || !request) {
+        return BRIDGE_ERR_INVALID_ARG;
     }
     
-    if (!config) {
+    bridge_queue_pair_t *qp;
+    return queue_requests(ctx, request, 1, NULL, NULL, &qp);
+}
+
+/* Ring doorbells for all of a device's queue pairs */
+int bridge_ring_doorbell(device_context_t *ctx) {
+    if (!g_bridge.initialized || !ctx) {
         return BRIDGE_ERR_INVALID_ARG;
     }
     
-    /* Copy configuration */
-    memcpy(&g_bridge.config, config, sizeof(bridge_config_t));
+    uint32_t announced = 0;
+    for (uint32_t q = 0; q < ctx->queue_count; q++) {
+        announced += sq_doorbell(ctx->queues[q]);
+    }
     
-    /* Initialize statistics */
-    memset(&g_bridge.stats, 0, sizeof(bridge_stats_t));
+    return (int)announced;
+}
+
+/* Reap completions */
+int bridge_reap_completions(device_context_t *ctx, uint32_t queue_id,
+                            bridge_completion_t *completions,
+                            uint32_t max_completions) {
+    if (!g_bridge.initialized || !ctx || !completions || queue_id >= ctx->queue_count) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
     
-    /* Initialize locks */
-    pthread_mutex_init(&g_bridge.lock, NULL);
-    pthread_mutex_init(&g_queue.lock, NULL);
-    pthread_cond_init(&g_queue.not_empty, NULL);
+    bridge_queue_pair_t *qp = ctx->queues[queue_id];
+    uint32_t count = 0;
     
-    /* Initialize queue */
-    g_queue.head = 0;
-    g_queue.tail = 0;
-    g_queue.count = 0;
+    pthread_mutex_lock(&qp->lock);
+    while (count < max_completions && qp->cq_head != qp->cq_tail) {
+        completions[count++] = qp->cq[qp->cq_head & qp->mask];
+        qp->cq_head++;
+    }
     
-    /* Initialize AI buffer if enabled */
-    if (config->ai_enabled) {
-        if (ai_buffer_init(config->mode == BRIDGE_MODE_LEARNING) != AI_SUCCESS) {
-            fprintf(stderr, "[BRIDGE] Failed to initialize AI buffer\n");
-            return BRIDGE_ERR_AI_FAILURE;
-        }
-        printf("[BRIDGE] AI buffer initialized in %s mode\n",
-               config->mode == BRIDGE_MODE_LEARNING ? "learning" : "inference");
+    /* Re-arm the completion fd once the queue is empty */
+    if (qp->cq_signaled && qp->cq_head == qp->cq_tail) {
+        drain_event_fd(qp->cq_event_fd);
+        qp->cq_signaled = false;
     }
+    pthread_mutex_unlock(&qp->lock);
     
-    /* Start worker thread */
-    g_bridge.worker_running = true;
-    if (pthread_create(&g_bridge.worker_thread, NULL, worker_thread_func, NULL) != 0) {
-        fprintf(stderr, "[BRIDGE] Failed to create worker thread\n");
-        return BRIDGE_ERR_DEVICE;
+    return (int)count;
+}
+
+/* Helper: create an eventfd on first use */
+static int get_event_fd(device_context_t *ctx, uint32_t queue_id, bool completion) {
+    if (!g_bridge.initialized || !ctx || queue_id >= ctx->queue_count) {
+        return BRIDGE_ERR_INVALID_ARG;
     }
     
-    g_bridge.initialized = true;
-    printf("[BRIDGE] Initialized in mode %d for chipset type %d\n",
-           config->mode, config->chipset_type);
+    bridge_queue_pair_t *qp = ctx->queues[queue_id];
+    int *fd = completion ? &qp->cq_event_fd : &qp->sq_space_fd;
     
-    return BRIDGE_SUCCESS;
+    pthread_mutex_lock(&qp->lock);
+    if (*fd < 0) {
+        *fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        
+        /* Completions posted before the fd existed still need a wakeup */
+        if (*fd >= 0 && completion && qp->cq_head != qp->cq_tail) {
+            signal_event_fd(*fd);
+            qp->cq_signaled = true;
+        }
+    }
+    int ret = *fd >= 0 ? *fd : BRIDGE_ERR_NO_MEMORY;
+    pthread_mutex_unlock(&qp->lock);
+    
+    return ret;
 }
 
-/* Shutdown bridge */
-void bridge_shutdown(void) {
-    if (!g_bridge.initialized) {
-        return;
+/* Get completion-ready fd */
+int bridge_get_completion_fd(device_context_t *ctx, uint32_t queue_id) {
+    return get_event_fd(ctx, queue_id, true);
+}
+
+/* Get space-available fd */
+int bridge_get_space_fd(device_context_t *ctx, uint32_t queue_id) {
+    return get_event_fd(ctx, queue_id, false);
+}
+
+/* Send response */
+int bridge_send_response(device_context_t *ctx, const uint8_t *data, uint32_t size) {
+    if (!g_bridge.initialized || !ctx || !data) {
+        return BRIDGE_ERR_INVALID_ARG;
     }
     
-    printf("[BRIDGE] Shutting down...\n");
+    printf("[BRIDGE] Send response to Windows device 0x%x (%u bytes)\n", 
+           ctx->device_id, size);
     
-    /* Stop worker thread */
-    g_bridge.worker_running = false;
-    pthread_cond_signal(&g_queue.not_empty);
-    pthread_join(g_bridge.worker_thread, NULL);
+    g_bridge.stats.linux_to_windows++;
     
-    /* Shutdown AI buffer */
-    if (g_bridge.config.ai_enabled) {
-        ai_buffer_shutdown();
+    return BRIDGE_SUCCESS;
+}
+
+/* Get statistics */
+void bridge_get_stats(bridge_stats_t *stats) {
+    if (!g_bridge.initialized || !stats) {
+        return;
     }
     
-    /* Cleanup devices */
     pthread_mutex_lock(&g_bridge.lock);
-    for (uint32_t i = 0; i < g_bridge.device_count; i++) {
-        if (g_bridge.devices[i]) {
-            free(g_bridge.devices[i]);
-            g_bridge.devices[i] = NULL;
-        }
+    memcpy(stats, &g_bridge.stats, sizeof(bridge_stats_t));
+    
+    /* Get AI statistics */
+    if (g_bridge.ai_started) {
+        uint64_t ai_requests;
+        ai_buffer_get_stats(&ai_requests, &stats->ai_accuracy, &stats->avg_latency_us);
     }
-    g_bridge.device_count = 0;
-    pthread_mutex_unlock(&g_bridge.lock);
     
-    /* Destroy locks */
-    pthread_mutex_destroy(&g_bridge.lock);
-    pthread_mutex_destroy(&g_queue.lock);
-    pthread_cond_destroy(&g_queue.not_empty);
+    pthread_mutex_unlock(&g_bridge.lock);
     
-    g_bridge.initialized = false;
-    printf("[BRIDGE] Shutdown complete\n");
+    /* Get worker pool statistics */
+    pthread_mutex_lock(&g_queue.lock);
+    stats->total_requests = g_bridge.stats.total_requests;
+    stats->failures = g_bridge.stats.failures;
+    stats->active_workers = g_pool.live - g_pool.retire;
+    stats->queue_depth = g_queue.pending;
+    stats->doorbells = g_queue.doorbells;
+    stats->cq_overflows = g_queue.cq_overflows;
+    stats->event_signals = g_queue.event_signals;
+    stats->rate_limited = g_queue.rate_limited;
+    stats->config_version = snapshot_get()->version;
+    cfg_put();
+    stats->config_reclaimed = __atomic_load_n(&g_bridge.config_reclaimed, __ATOMIC_RELAXED);
+    stats->sync_spin_hits = __atomic_load_n(&g_sync.spin_hits, __ATOMIC_RELAXED);
+    stats->sync_sleeps = __atomic_load_n(&g_sync.sleeps, __ATOMIC_RELAXED);
+    stats->sync_timeouts = __atomic_load_n(&g_sync.timeouts, __ATOMIC_RELAXED);
+    stats->avg_queue_wait_us = g_pool.last_wait_us;
+    stats->worker_utilization = g_pool.last_utilization;
+    stats->scale_ups = g_pool.scale_ups;
+    stats->scale_downs = g_pool.scale_downs;
+    stats->numa_nodes = g_affinity.node_count;
+    stats->local_dispatches = g_affinity.local_dispatches;
+    stats->remote_dispatches = g_affinity.remote_dispatches;
+    pthread_mutex_unlock(&g_queue.lock);
 }
 
-/* Register device */
-device_context_t* bridge_register_device(uint32_t device_id,
-                                         chipset_type_t chipset_type,
-                                         void *windows_device,
-                                         void *linux_device) {
+/* Get scaling history */
+int bridge_get_scale_events(bridge_scale_event_t *events, uint32_t max_events,
+                            uint32_t *count) {
     if (!g_bridge.initialized) {
-        return NULL;
+        return BRIDGE_ERR_NOT_INIT;
     }
     
-    pthread_mutex_lock(&g_bridge.lock);
+    if (!events || !count) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
     
-    if (g_bridge.device_count >= 256) {
-        pthread_mutex_unlock(&g_bridge.lock);
-        return NULL;
+    pthread_mutex_lock(&g_queue.lock);
+    
+    uint64_t available = g_pool.history_count < BRIDGE_SCALE_HISTORY ?
+                         g_pool.history_count : BRIDGE_SCALE_HISTORY;
+    if (available > max_events) {
+        available = max_events;
     }
     
-    /* Allocate device context */
-    device_context_t *ctx = (device_context_t*)malloc(sizeof(device_context_t));
-    if (!ctx) {
-        pthread_mutex_unlock(&g_bridge.lock);
-        return NULL;
+    uint64_t first = g_pool.history_count - available;
+    for (uint64_t i = 0; i < available; i++) {
+        events[i] = g_pool.history[(first + i) % BRIDGE_SCALE_HISTORY];
     }
+    *count = (uint32_t)available;
     
-    /* Initialize context */
-    ctx->device_id = device_id;
-    ctx->chipset_type = chipset_type;
-    ctx->windows_device_object = windows_device;
-    ctx->linux_device_handle = linux_device;
-    ctx->ai_managed = g_bridge.config.ai_enabled;
-    ctx->active_requests = 0;
+    pthread_mutex_unlock(&g_queue.lock);
     
-    /* Add to device list */
-    g_bridge.devices[g_bridge.device_count++] = ctx;
+    return BRIDGE_SUCCESS;
+}
+
+/* Get current configuration */
+int bridge_get_config(bridge_config_t *config, uint64_t *version) {
+    if (!g_bridge.initialized) {
+        return BRIDGE_ERR_NOT_INIT;
+    }
     
-    pthread_mutex_unlock(&g_bridge.lock);
+    if (!config) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
     
-    printf("[BRIDGE] Registered device 0x%x (chipset type %d)\n", device_id, chipset_type);
+    const bridge_config_snapshot_t *snap = snapshot_get();
+    memcpy(config, &snap->config, sizeof(bridge_config_t));
+    if (version) {
+        *version = snap->version;
+    }
+    cfg_put();
     
-    return ctx;
+    return BRIDGE_SUCCESS;
 }
 
-/* Unregister device */
-void bridge_unregister_device(device_context_t *ctx) {
-    if (!g_bridge.initialized || !ctx) {
-        return;
+/* Apply new configuration */
+int bridge_update_config(const bridge_config_t *config) {
+    if (!g_bridge.initialized) {
+        return BRIDGE_ERR_NOT_INIT;
     }
     
-    pthread_mutex_lock(&g_bridge.lock);
+    if (!config) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
     
-    /* Find and remove device */
-    for (uint32_t i = 0; i < g_bridge.device_count; i++) {
-        if (g_bridge.devices[i] == ctx) {
-            /* Shift remaining devices */
-            for (uint32_t j = i; j < g_bridge.device_count - 1; j++) {
-                g_bridge.devices[j] = g_bridge.devices[j + 1];
+    pthread_mutex_lock(&g_bridge.config_lock);
+    bridge_config_t next;
+    memcpy(&next, config, sizeof(bridge_config_t));
+    next.chipset_type = cfg()->chipset_type;
+    int ret = publish_config(&next);
+    pthread_mutex_unlock(&g_bridge.config_lock);
+    
+    return ret;
+}
+
+/* Config file keys that map directly onto uint32_t fields */
+static const struct {
+    const char *key;
+    size_t offset;
+} config_keys[] = {
+    {"max_pending_requests", offsetof(bridge_config_t, max_pending_requests)},
+    {"batch_timeout_ms",     offsetof(bridge_config_t, batch_timeout_ms)},
+    {"min_workers",          offsetof(bridge_config_t, min_workers)},
+    {"max_workers",          offsetof(bridge_config_t, max_workers)},
+    {"scale_up_depth",       offsetof(bridge_config_t, scale_up_depth)},
+    {"scale_up_wait_us",     offsetof(bridge_config_t, scale_up_wait_us)},
+    {"queues_per_device",    offsetof(bridge_config_t, queues_per_device)},
+    {"queue_depth",          offsetof(bridge_config_t, queue_depth)},
+    {"rate_limit_rps",       offsetof(bridge_config_t, rate_limit_rps)},
+    {"rate_limit_burst",     offsetof(bridge_config_t, rate_limit_burst)},
+    {"sync_timeout_us",      offsetof(bridge_config_t, sync_timeout_us)},
+    {NULL, 0}
+};
+
+/* Request type names for "priority.<type>" keys */
+static const char *request_type_names[REQ_UNKNOWN] = {
+    "io_read", "io_write", "dma_alloc", "interrupt", "pci_config", "power_state"
+};
+
+/* Bridge mode names for the "mode" key */
+static const char *mode_names[] = {
+    "passthrough", "ai_assisted", "ai_autonomous", "learning"
+};
+
+/* Helper: trim whitespace in place */
+static char* trim(char *str) {
+    while (isspace((unsigned char)*str)) str++;
+    char *end = str + strlen(str);
+    while (end > str && isspace((unsigned char)end[-1])) end--;
+    *end = '\0';
+    return str;
+}
+
+/* Helper: parse one "key = value" setting into a configuration */
+static int parse_config_line(bridge_config_t *c, const char *key, const char *value) {
+    char *end;
+    unsigned long number = strtoul(value, &end, 0);
+    bool is_number = *value != '\0' && *end == '\0';
+    
+    for (int i = 0; config_keys[i].key != NULL; i++) {
+        if (strcmp(key, config_keys[i].key) == 0) {
+            if (!is_number) return BRIDGE_ERR_CONFIG;
+            *(uint32_t*)((uint8_t*)c + config_keys[i].offset) = (uint32_t)number;
+            return BRIDGE_SUCCESS;
+        }
+    }
+    
+    bool *flag = strcmp(key, "ai_enabled") == 0 ? &c->ai_enabled :
+                 strcmp(key, "numa_affinity") == 0 ? &c->numa_affinity : NULL;
+    if (flag) {
+        if (strcmp(value, "true") == 0 || strcmp(value, "yes") == 0 ||
+            strcmp(value, "on") == 0 || (is_number && number == 1)) {
+            *flag = true;
+        } else if (strcmp(value, "false") == 0 || strcmp(value, "no") == 0 ||
+                   strcmp(value, "off") == 0 || (is_number && number == 0)) {
+            *flag = false;
+        } else {
+            return BRIDGE_ERR_CONFIG;
+        }
+        return BRIDGE_SUCCESS;
+    }
+    
+    if (strcmp(key, "mode") == 0) {
+        for (int m = 0; m <= BRIDGE_MODE_LEARNING; m++) {
+            if (strcmp(value, mode_names[m]) == 0 || (is_number && number == (unsigned long)m)) {
+                c->mode = (bridge_mode_t)m;
+                return BRIDGE_SUCCESS;
             }
-            g_bridge.devices[--g_bridge.device_count] = NULL;
-            break;
         }
+        return BRIDGE_ERR_CONFIG;
     }
     
-    pthread_mutex_unlock(&g_bridge.lock);
+    if (strncmp(key, "priority.", 9) == 0 && is_number) {
+        for (int t = 0; t < REQ_UNKNOWN; t++) {
+            if (strcmp(key + 9, request_type_names[t]) == 0) {
+                c->type_priority[t] = (uint32_t)number;
+                return BRIDGE_SUCCESS;
+            }
+        }
+    }
     
-    printf("[BRIDGE] Unregistered device 0x%x\n", ctx->device_id);
-    free(ctx);
+    return BRIDGE_ERR_CONFIG;
 }
 
-/* Forward request */
-int bridge_forward_request(device_context_t *ctx, const comm_request_t *request) {
-    if (!g_bridge.initialized || !ctx || !request) {
+/* Reload configuration from file */
+int bridge_reload_config(const char *path) {
+    if (!g_bridge.initialized) {
+        return BRIDGE_ERR_NOT_INIT;
+    }
+    
+    if (!path) {
         return BRIDGE_ERR_INVALID_ARG;
     }
     
-    g_bridge.stats.total_requests++;
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "[BRIDGE] Cannot read config %s\n", path);
+        return BRIDGE_ERR_CONFIG;
+    }
+    
+    pthread_mutex_lock(&g_bridge.config_lock);
     
-    /* Add to queue */
-    pthread_mutex_lock(&g_queue.lock);
+    /* Start from the current settings; the file only overrides */
+    bridge_config_t next;
+    memcpy(&next, cfg(), sizeof(bridge_config_t));
     
-    if (g_queue.count >= 1024) {
-        pthread_mutex_unlock(&g_queue.lock);
-        g_bridge.stats.failures++;
-        return BRIDGE_ERR_TIMEOUT;
+    char line[256];
+    int line_no = 0;
+    int ret = BRIDGE_SUCCESS;
+    while (fgets(line, sizeof(line), f)) {
+        line_no++;
+        char *comment = strchr(line, '#');
+        if (comment) *comment = '\0';
+        
+        char *key = trim(line);
+        if (*key == '\0') continue;
+        
+        char *eq = strchr(key, '=');
+        if (!eq) {
+            ret = BRIDGE_ERR_CONFIG;
+        } else {
+            *eq = '\0';
+            ret = parse_config_line(&next, trim(key), trim(eq + 1));
+        }
+        if (ret != BRIDGE_SUCCESS) {
+            fprintf(stderr, "[BRIDGE] %s:%d: invalid setting, config not applied\n",
+                    path, line_no);
+            break;
+        }
     }
+    fclose(f);
     
-    uint32_t idx = g_queue.tail;
-    memcpy(&g_queue.requests[idx], request, sizeof(comm_request_t));
-    g_queue.contexts[idx] = ctx;
-    g_queue.tail = (g_queue.tail + 1) % 1024;
-    g_queue.count++;
-    ctx->active_requests++;
+    if (ret == BRIDGE_SUCCESS) {
+        ret = publish_config(&next);
+    }
     
-    /* Signal worker thread */
-    pthread_cond_signal(&g_queue.not_empty);
+    pthread_mutex_unlock(&g_bridge.config_lock);
     
-    pthread_mutex_unlock(&g_queue.lock);
+    return ret;
+}
+
+/* Config watcher thread: inotify on the file's directory plus reload requests */
+static void* config_watch_func(void *arg) {
+    (void)arg;
     
-    return BRIDGE_SUCCESS;
+    while (g_watch.running) {
+        struct pollfd fds[2] = {
+            {.fd = g_watch.inotify_fd, .events = POLLIN},
+            {.fd = g_watch.wake_fd, .events = POLLIN}
+        };
+        if (poll(fds, 2, -1) < 0) {
+            continue;
+        }
+        
+        bool reload = false;
+        
+        if (fds[0].revents & POLLIN) {
+            /* Editors often write a temp file and rename it over the original */
+            char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+            ssize_t len = read(g_watch.inotify_fd, buf, sizeof(buf));
+            for (ssize_t off = 0; off < len; ) {
+                const struct inotify_event *ev = (const struct inotify_event*)(buf + off);
+                if (ev->len > 0 && strcmp(ev->name, g_watch.name) == 0) {
+                    reload = true;
+                }
+                off += sizeof(struct inotify_event) + ev->len;
+            }
+        }
+        
+        if (fds[1].revents & POLLIN) {
+            drain_event_fd(g_watch.wake_fd);
+            reload = g_watch.running;
+        }
+        
+        if (reload) {
+            printf("[BRIDGE] Reloading config from %s\n", g_watch.path);
+            bridge_reload_config(g_watch.path);
+        }
+    }
+    
+    return NULL;
 }
 
-/* Send response */
-int bridge_send_response(device_context_t *ctx, const uint8_t *data, uint32_t size) {
-    if (!g_bridge.initialized || !ctx || !data) {
+/* Watch config file */
+int bridge_watch_config(const char *path) {
+    if (!g_bridge.initialized) {
+        return BRIDGE_ERR_NOT_INIT;
+    }
+    
+    if (!path || strlen(path) >= sizeof(g_watch.path)) {
         return BRIDGE_ERR_INVALID_ARG;
     }
     
-    printf("[BRIDGE] Send response to Windows device 0x%x (%u bytes)\n", 
-           ctx->device_id, size);
+    stop_config_watch();
     
-    g_bridge.stats.linux_to_windows++;
+    /* Watch the directory so replaced files are noticed too */
+    char dir[256];
+    const char *slash = strrchr(path, '/');
+    if (slash) {
+        snprintf(dir, sizeof(dir), "%.*s", (int)(slash - path) > 0 ? (int)(slash - path) : 1, path);
+        snprintf(g_watch.name, sizeof(g_watch.name), "%s", slash + 1);
+    } else {
+        snprintf(dir, sizeof(dir), ".");
+        snprintf(g_watch.name, sizeof(g_watch.name), "%s", path);
+    }
+    snprintf(g_watch.path, sizeof(g_watch.path), "%s", path);
+    
+    g_watch.inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    g_watch.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (g_watch.inotify_fd < 0 || g_watch.wake_fd < 0 ||
+        inotify_add_watch(g_watch.inotify_fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        fprintf(stderr, "[BRIDGE] Cannot watch config directory %s\n", dir);
+        if (g_watch.inotify_fd >= 0) close(g_watch.inotify_fd);
+        if (g_watch.wake_fd >= 0) close(g_watch.wake_fd);
+        g_watch.inotify_fd = -1;
+        g_watch.wake_fd = -1;
+        return BRIDGE_ERR_CONFIG;
+    }
     
-    if (ctx->active_requests > 0) {
-        ctx->active_requests--;
+    g_watch.running = true;
+    if (pthread_create(&g_watch.thread, NULL, config_watch_func, NULL) != 0) {
+        g_watch.running = false;
+        close(g_watch.inotify_fd);
+        close(g_watch.wake_fd);
+        g_watch.inotify_fd = -1;
+        g_watch.wake_fd = -1;
+        return BRIDGE_ERR_DEVICE;
     }
+    __atomic_store_n(&g_watch.signal_fd, g_watch.wake_fd, __ATOMIC_SEQ_CST);
+    
+    printf("[BRIDGE] Watching config %s\n", path);
     
     return BRIDGE_SUCCESS;
 }
 
-/* Get statistics */
-void bridge_get_stats(bridge_stats_t *stats) {
-    if (!g_bridge.initialized || !stats) {
-        return;
+/* Request reload (async-signal-safe) */
+void bridge_request_reload(void) {
+    /* Lock-free: the stopping watcher waits for signalers before closing */
+    __atomic_add_fetch(&g_watch.signalers, 1, __ATOMIC_SEQ_CST);
+    int fd = __atomic_load_n(&g_watch.signal_fd, __ATOMIC_SEQ_CST);
+    if (fd >= 0) {
+        uint64_t one = 1;
+        if (write(fd, &one, sizeof(one)) < 0) {
+            /* Already pending */
+        }
+    }
+    __atomic_sub_fetch(&g_watch.signalers, 1, __ATOMIC_SEQ_CST);
+}
+
+/* Set mode */
+int bridge_set_mode(bridge_mode_t mode) {
+    if (!g_bridge.initialized) {
+        return BRIDGE_ERR_NOT_INIT;
     }
     
-    pthread_mutex_lock(&g_bridge.lock);
-    memcpy(stats, &g_bridge.stats, sizeof(bridge_stats_t));
+    pthread_mutex_lock(&g_bridge.config_lock);
+    bridge_config_t next;
+    memcpy(&next, cfg(), sizeof(bridge_config_t));
+    next.mode = mode;
+    int ret = publish_config(&next);
+    pthread_mutex_unlock(&g_bridge.config_lock);
     
-    /* Get AI statistics */
-    if (g_bridge.config.ai_enabled) {
-        uint64_t ai_requests;
-        ai_buffer_get_stats(&ai_requests, &stats->ai_accuracy, &stats->avg_latency_us);
+    if (ret == BRIDGE_SUCCESS) {
+        printf("[BRIDGE] Mode changed to %d\n", mode);
     }
     
-    pthread_mutex_unlock(&g_bridge.lock);
+    return ret;
 }
 
-/* Set mode */
-int bridge_set_mode(bridge_mode_t mode) {
+/* Select the backend for new devices */
+int bridge_set_backend(const bridge_backend_t *backend) {
     if (!g_bridge.initialized) {
         return BRIDGE_ERR_NOT_INIT;
     }
     
+    if (backend && !backend->execute) {
+        return BRIDGE_ERR_INVALID_ARG;
+    }
+    
     pthread_mutex_lock(&g_bridge.lock);
-    g_bridge.config.mode = mode;
+    g_bridge.backend = backend;
     pthread_mutex_unlock(&g_bridge.lock);
     
-    printf("[BRIDGE] Mode changed to %d\n", mode);
+    printf("[BRIDGE] Backend set to %s\n", backend ? backend->name : "simulated");
     
     return BRIDGE_SUCCESS;
 }
 
 /* Initialize chipset-specific handling */
 int bridge_chipset_init(chipset_type_t chipset_type) {
+    static const char *const vendors[] = {
+        [CHIPSET_INTEL] = "Intel",
+        [CHIPSET_AMD] = "AMD",
+        [CHIPSET_NVIDIA] = "NVIDIA",
+        [CHIPSET_QUALCOMM] = "Qualcomm"
+    };
+    
     printf("[BRIDGE] Initializing chipset-specific handling for type %d\n", chipset_type);
     
-    switch (chipset_type) {
-        case CHIPSET_INTEL:
-            printf("[BRIDGE] Intel chipset detected - enabling optimization\n");
-            break;
-        case CHIPSET_AMD:
-            printf("[BRIDGE] AMD chipset detected - enabling optimization\n");
-            break;
-        case CHIPSET_NVIDIA:
-            printf("[BRIDGE] NVIDIA chipset detected - enabling optimization\n");
-            break;
-        case CHIPSET_QUALCOMM:
-            printf("[BRIDGE] Qualcomm chipset detected - enabling optimization\n");
-            break;
-        default:
-            printf("[BRIDGE] Unknown chipset - using generic handling\n");
-            break;
+    /* Vendor behaviour lives in the chipset layer's operations tables */
+    if (chipset_type < CHIPSET_UNKNOWN) {
+        printf("[BRIDGE] %s chipset detected - enabling optimization\n", vendors[chipset_type]);
+    } else {
+        printf("[BRIDGE] Unknown chipset - using generic handling\n");
     }
     
     return BRIDGE_SUCCESS;
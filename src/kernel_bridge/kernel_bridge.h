@@ -73,13 +73,34 @@ typedef enum {
     CHIPSET_UNKNOWN
 } chipset_type_t;
 
+/* Worker pool ceiling */
+#define BRIDGE_MAX_WORKERS      64
+
+/* NUMA nodes the affinity policy tracks */
+#define BRIDGE_MAX_NODES        16
+
+/* Queue pair limits */
+#define BRIDGE_MAX_QUEUES       16      /* Queue pairs per device */
+#define BRIDGE_INLINE_DATA      16      /* Write payload bytes copied into the queue */
+
 /* Bridge configuration */
 typedef struct {
     bridge_mode_t mode;
     bool ai_enabled;
     uint32_t max_pending_requests;
-    uint32_t batch_timeout_ms;
+    uint32_t batch_timeout_ms;      /* Batch window, also the scaler sampling period */
     chipset_type_t chipset_type;
+    uint32_t min_workers;           /* Worker pool floor (0 = 1) */
+    uint32_t max_workers;           /* Worker pool ceiling (0 = min_workers) */
+    uint32_t scale_up_depth;        /* Queued requests per worker that count as pressure (0 = 32) */
+    uint32_t scale_up_wait_us;      /* Average queue wait that counts as pressure (0 = 1000) */
+    uint32_t queues_per_device;     /* Queue pairs per device (0 = 1) */
+    uint32_t queue_depth;           /* Entries per submission/completion queue (0 = 256) */
+    uint32_t rate_limit_rps;        /* Admitted requests per second (0 = unlimited) */
+    uint32_t rate_limit_burst;      /* Token bucket size (0 = rate_limit_rps / 10) */
+    uint32_t type_priority[REQ_UNKNOWN]; /* Priority override per request type (0 = keep) */
+    uint32_t sync_timeout_us;       /* Default wait for synchronous requests (0 = 100000) */
+    bool numa_affinity;             /* Pin workers and queue memory to device NUMA nodes */
 } bridge_config_t;
 
 /* Bridge statistics */
@@ -92,8 +113,60 @@ typedef struct {
     uint64_t failures;
     uint32_t avg_latency_us;
     float ai_accuracy;
+    
+    /* Worker pool */
+    uint32_t active_workers;
+    uint32_t queue_depth;
+    uint32_t avg_queue_wait_us;     /* Over the last sampling period */
+    float worker_utilization;       /* Over the last sampling period (0.0-1.0) */
+    uint64_t scale_ups;
+    uint64_t scale_downs;
+    
+    /* Queue pairs */
+    uint64_t doorbells;             /* Batches announced to the workers */
+    uint64_t cq_overflows;          /* Completions dropped from full completion queues */
+    uint64_t event_signals;         /* eventfd writes (completion-ready + space-available) */
+    
+    /* Configuration */
+    uint64_t config_version;        /* Incremented by every applied change */
+    uint64_t config_reclaimed;      /* Replaced snapshots freed so far */
+    uint64_t rate_limited;          /* Requests refused by the rate limit */
+    
+    /* Synchronous waits */
+    uint64_t sync_spin_hits;        /* Completed while spinning */
+    uint64_t sync_sleeps;           /* Had to sleep on the futex */
+    uint64_t sync_timeouts;
+    
+    /* NUMA affinity */
+    uint32_t numa_nodes;            /* Nodes with registered devices */
+    uint64_t local_dispatches;      /* Batches run by a worker on the device's node */
+    uint64_t remote_dispatches;     /* Batches a worker took from another node */
 } bridge_stats_t;
 
+/* Round-trip latency histogram: bucket i counts [2^i, 2^(i+1)) ns */
+#define BRIDGE_LATENCY_BUCKETS  32
+
+typedef struct {
+    uint64_t buckets[BRIDGE_LATENCY_BUCKETS];
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t min_ns;
+    uint64_t max_ns;
+} bridge_latency_hist_t;
+
+/* Worker pool scaling decision */
+typedef struct {
+    uint64_t timestamp_ms;          /* CLOCK_MONOTONIC */
+    uint32_t old_workers;
+    uint32_t new_workers;
+    uint32_t queue_depth;
+    uint32_t avg_wait_us;
+    float utilization;
+} bridge_scale_event_t;
+
+/* Submission/completion queue pair (private to the bridge) */
+typedef struct bridge_queue_pair bridge_queue_pair_t;
+
 /* Device context for chipset drivers */
 typedef struct {
     uint32_t device_id;
@@ -102,8 +175,45 @@ typedef struct {
     void *linux_device_handle;
     bool ai_managed;
     uint32_t active_requests;
+    bridge_queue_pair_t *queues[BRIDGE_MAX_QUEUES];
+    uint32_t queue_count;
+    const struct bridge_backend *backend;   /* Bound at registration */
+    void *backend_state;
+    int32_t numa_node;                      /* -1 until bridge_set_device_affinity() */
 } device_context_t;
 
+/* Request backend. The default simulates the Linux side with fixed read
+ * values; an alternative (e.g. the chipset emulator) can be installed
+ * with bridge_set_backend(). @execute runs on a worker thread and may be
+ * called concurrently for one device from different queue pairs. */
+typedef struct bridge_backend {
+    const char *name;
+    void* (*attach)(device_context_t *ctx);     /* Per-device state, NULL on error */
+    void (*detach)(device_context_t *ctx, void *state);
+    int (*execute)(device_context_t *ctx, void *state,
+                   const comm_request_t *request, uint64_t *value);
+} bridge_backend_t;
+
+/* Completion queue entry */
+typedef struct {
+    uint32_t device_id;
+    request_type_t type;
+    uint64_t address;
+    uint64_t value;                 /* Read result */
+    int32_t status;                 /* BRIDGE_SUCCESS or BRIDGE_ERR_* */
+    uint32_t queue_id;
+    void *user_data;                /* As passed to bridge_submit_async() */
+    uint64_t latency_ns;            /* Submission to completion */
+} bridge_completion_t;
+
+/* Completion callback, called on a bridge worker thread; must not block */
+typedef void (*bridge_completion_fn)(device_context_t *ctx,
+                                     const bridge_completion_t *completion,
+                                     void *user_data);
+
+/* Waitable completion (private to the bridge) */
+typedef struct bridge_future bridge_future_t;
+
 /* API Functions */
 
 /**
@@ -133,6 +243,22 @@ device_context_t* bridge_register_device(uint32_t device_id,
                                          void *windows_device,
                                          void *linux_device);
 
+/**
+ * bridge_set_device_affinity - Tell the bridge where a device sits
+ * @ctx: Device context
+ * @numa_node: NUMA node of the device
+ * @cpulist: CPUs local to the device, sysfs list format (e.g. "0-7,16-23")
+ * 
+ * With numa_affinity set, each node with devices gets a share of the
+ * workers, pinned to its CPUs. Workers take queue pairs of their own
+ * node first and others only when none is waiting, so completion
+ * callbacks run near the device. The device's queue rings move to its
+ * node's memory.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_set_device_affinity(device_context_t *ctx, int32_t numa_node, const char *cpulist);
+
 /**
  * bridge_unregister_device - Unregister a device
  * @ctx: Device context
@@ -148,6 +274,207 @@ void bridge_unregister_device(device_context_t *ctx);
  */
 int bridge_forward_request(device_context_t *ctx, const comm_request_t *request);
 
+/**
+ * bridge_submit_batch - Queue several requests and ring the doorbell once
+ * @ctx: Device context
+ * @requests: Requests to submit, in order
+ * @count: Number of requests
+ * 
+ * All requests land on the calling thread's queue pair, so they are
+ * executed in order. Either every request is queued or none is.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_submit_batch(device_context_t *ctx, const comm_request_t *requests,
+                        uint32_t count);
+
+/**
+ * bridge_submit_async - Submit a request with a completion callback
+ * @ctx: Device context
+ * @request: Request to submit
+ * @callback: Called once with the result instead of posting to the
+ *            completion queue
+ * @user_data: Passed to @callback
+ * 
+ * Read results are returned in the completion's value and, when
+ * @request->data is set, copied to that buffer, which must stay valid
+ * until the callback runs. The callback may submit further requests.
+ * 
+ * Returns: 0 on success, negative on error (the callback is not called)
+ */
+int bridge_submit_async(device_context_t *ctx, const comm_request_t *request,
+                        bridge_completion_fn callback, void *user_data);
+
+/**
+ * bridge_submit_batch_async - Submit requests that complete one callback
+ * @ctx: Device context
+ * @requests: Requests, executed in array order
+ * @count: Number of requests (at most the queue depth)
+ * @callback: Called once, when the last request completes, with the
+ *            first failure in the batch as its status
+ * @user_data: Passed to @callback
+ * 
+ * Buffer lifetimes are as for bridge_submit_batch_future().
+ * 
+ * Returns: 0 on success, negative on error (the callback is not called)
+ */
+int bridge_submit_batch_async(device_context_t *ctx, const comm_request_t *requests,
+                              uint32_t count, bridge_completion_fn callback,
+                              void *user_data);
+
+/**
+ * bridge_future_create - Allocate a reusable future
+ * 
+ * Returns: Future on success, NULL on error
+ */
+bridge_future_t* bridge_future_create(void);
+
+/**
+ * bridge_future_release - Drop the caller's reference to a future
+ * @future: Future to release
+ * 
+ * Safe while a request is still in flight: the bridge frees the future
+ * when that request completes.
+ */
+void bridge_future_release(bridge_future_t *future);
+
+/**
+ * bridge_future_buffer - Get scratch space that lives as long as a future
+ * @future: Future with no request in flight
+ * @size: Minimum size in bytes (grown, never shrunk)
+ * 
+ * Request payloads placed here stay valid even if the waiter times out
+ * and releases the future, because the bridge holds a reference until
+ * the request completes.
+ * 
+ * Returns: Buffer on success, NULL on error
+ */
+void* bridge_future_buffer(bridge_future_t *future, size_t size);
+
+/**
+ * bridge_submit_future - Submit a request that completes a future
+ * @ctx: Device context
+ * @request: Request to submit
+ * @future: Future to complete; must not have a request in flight
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_submit_future(device_context_t *ctx, const comm_request_t *request,
+                         bridge_future_t *future);
+
+/**
+ * bridge_submit_batch_future - Submit requests that complete one future
+ * @ctx: Device context
+ * @requests: Requests, executed in array order
+ * @count: Number of requests (at most the queue depth)
+ * @future: Completed when the last request completes; must not have a
+ *          request in flight
+ * 
+ * Earlier requests complete silently, without completion queue entries;
+ * the future's status is the first failure in the batch. Write payloads
+ * larger than BRIDGE_INLINE_DATA, and scatter-gather lists with their
+ * buffers, must stay valid until the future completes.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_submit_batch_future(device_context_t *ctx, const comm_request_t *requests,
+                               uint32_t count, bridge_future_t *future);
+
+/**
+ * bridge_future_wait - Wait for a future's request to complete
+ * @future: Future passed to bridge_submit_future()
+ * @timeout_us: Maximum wait (0 = sync_timeout_us from the config)
+ * @completion: Output completion (may be NULL)
+ * 
+ * Spins briefly when recent round trips have been short, then sleeps
+ * on a futex. Round trips of single-register reads are recorded in the
+ * sync latency histogram; batches, transfers and writes are not.
+ * After a timeout the request is still in flight: release the future
+ * instead of reusing it.
+ * 
+ * Returns: 0 when completed, BRIDGE_ERR_TIMEOUT on timeout
+ */
+int bridge_future_wait(bridge_future_t *future, uint32_t timeout_us,
+                       bridge_completion_t *completion);
+
+/**
+ * bridge_get_sync_latency - Get the synchronous round-trip histogram
+ * @hist: Output histogram
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_get_sync_latency(bridge_latency_hist_t *hist);
+
+/**
+ * bridge_latency_percentile - Estimate a percentile from a histogram
+ * @hist: Histogram
+ * @percentile: 0.0-100.0
+ * 
+ * Returns: Upper bound of the bucket holding the percentile, in ns
+ */
+uint64_t bridge_latency_percentile(const bridge_latency_hist_t *hist, float percentile);
+
+/**
+ * bridge_queue_request - Queue a request without ringing the doorbell
+ * @ctx: Device context
+ * @request: Request to queue
+ * 
+ * The request is not seen by the workers until bridge_ring_doorbell().
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_queue_request(device_context_t *ctx, const comm_request_t *request);
+
+/**
+ * bridge_ring_doorbell - Announce queued requests to the workers
+ * @ctx: Device context
+ * 
+ * Returns: Number of requests announced, negative on error
+ */
+int bridge_ring_doorbell(device_context_t *ctx);
+
+/**
+ * bridge_reap_completions - Collect completions from a queue pair
+ * @ctx: Device context
+ * @queue_id: Queue pair index
+ * @completions: Output array, oldest first
+ * @max_completions: Capacity of @completions
+ * 
+ * Returns: Number of completions collected, negative on error
+ */
+int bridge_reap_completions(device_context_t *ctx, uint32_t queue_id,
+                            bridge_completion_t *completions,
+                            uint32_t max_completions);
+
+/**
+ * bridge_get_completion_fd - Get a pollable completion-ready handle
+ * @ctx: Device context
+ * @queue_id: Queue pair index
+ * 
+ * Returns an eventfd that becomes readable when the queue pair has
+ * completions to reap. Workers signal it at most once until the queue
+ * is emptied by bridge_reap_completions(), which also resets it, so a
+ * level-triggered epoll loop wakes once per burst. The fd is created on
+ * first use and owned by the bridge; do not close it.
+ * 
+ * Returns: File descriptor on success, negative on error
+ */
+int bridge_get_completion_fd(device_context_t *ctx, uint32_t queue_id);
+
+/**
+ * bridge_get_space_fd - Get a pollable space-available handle
+ * @ctx: Device context
+ * @queue_id: Queue pair index
+ * 
+ * Returns an eventfd that becomes readable when a submission to this
+ * queue pair was refused because it was full and workers have since
+ * freed entries. It is reset by the next successful submission. The fd
+ * is created on first use and owned by the bridge; do not close it.
+ * 
+ * Returns: File descriptor on success, negative on error
+ */
+int bridge_get_space_fd(device_context_t *ctx, uint32_t queue_id);
+
 /**
  * bridge_send_response - Send response from Linux to Windows
  * @ctx: Device context
@@ -164,6 +491,72 @@ int bridge_send_response(device_context_t *ctx, const uint8_t *data, uint32_t si
  */
 void bridge_get_stats(bridge_stats_t *stats);
 
+/**
+ * bridge_get_scale_events - Get recent worker pool scaling decisions
+ * @events: Output array, oldest first
+ * @max_events: Capacity of @events
+ * @count: Output number of events written
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_get_scale_events(bridge_scale_event_t *events, uint32_t max_events,
+                            uint32_t *count);
+
+/**
+ * bridge_get_config - Get the configuration currently in effect
+ * @config: Output configuration (with defaults applied)
+ * @version: Output snapshot version (may be NULL)
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_get_config(bridge_config_t *config, uint64_t *version);
+
+/**
+ * bridge_update_config - Apply a new configuration without restarting
+ * @config: New configuration
+ * 
+ * The configuration is published as a new versioned snapshot that the
+ * hot paths pick up without locking. Batch window, queue cap, worker
+ * bounds, rate limit, priorities, mode and AI enablement take effect
+ * immediately; queues_per_device and queue_depth apply to devices
+ * registered afterwards. chipset_type is fixed at bridge_init().
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_update_config(const bridge_config_t *config);
+
+/**
+ * bridge_reload_config - Re-read configuration from a file
+ * @path: Config file of "key = value" lines; '#' starts a comment
+ * 
+ * Keys not present in the file keep their current values. Keys are the
+ * bridge_config_t field names, plus "priority.<type>" for type_priority
+ * (io_read, io_write, dma_alloc, interrupt, pci_config, power_state)
+ * and "mode" as passthrough, ai_assisted, ai_autonomous or learning.
+ * 
+ * Returns: 0 on success, negative on error (nothing is applied)
+ */
+int bridge_reload_config(const char *path);
+
+/**
+ * bridge_watch_config - Reload a config file whenever it changes
+ * @path: Config file to watch
+ * 
+ * Starts a watcher thread that calls bridge_reload_config() when the
+ * file is written or replaced, and when bridge_request_reload() is
+ * called. Stopped by bridge_shutdown().
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_watch_config(const char *path);
+
+/**
+ * bridge_request_reload - Ask the config watcher to reload now
+ * 
+ * Async-signal-safe, so it can be called from a SIGHUP handler.
+ */
+void bridge_request_reload(void);
+
 /**
  * bridge_set_mode - Change bridge operation mode
  * @mode: New mode
@@ -172,6 +565,17 @@ void bridge_get_stats(bridge_stats_t *stats);
  */
 int bridge_set_mode(bridge_mode_t mode);
 
+/**
+ * bridge_set_backend - Select the backend for devices registered from now on
+ * @backend: Backend, or NULL for the built-in simulation
+ * 
+ * Devices keep the backend they were registered with until they are
+ * unregistered. The table must stay valid while any such device exists.
+ * 
+ * Returns: 0 on success, negative on error
+ */
+int bridge_set_backend(const bridge_backend_t *backend);
+
 /* Chipset-specific operations */
 
 /**
@@ -209,5 +613,7 @@ int bridge_chipset_power_state(device_context_t *ctx, uint32_t state);
 #define BRIDGE_ERR_DEVICE       -4
 #define BRIDGE_ERR_TIMEOUT      -5
 #define BRIDGE_ERR_AI_FAILURE   -6
+#define BRIDGE_ERR_RATE_LIMITED -7
+#define BRIDGE_ERR_CONFIG       -8
 
 #endif /* KERNEL_BRIDGE_H */
@@ -0,0 +1,139 @@
+/*
+ * ParrotWinKernel - Configuration Reload Test
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Configuration Reload Test
+ * 
+ * Reloads a config file repeatedly while readers pin snapshots, and
+ * checks that replaced snapshots are freed while the bridge runs rather
+ * than piling up until shutdown.
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+#include "test_common.h"
+#include "kernel_bridge/kernel_bridge.h"
+
+#define TEST_READERS    4
+#define TEST_RELOADS    500
+
+static volatile bool g_stop = false;
+static device_context_t *g_device = NULL;
+
+/* Reader: every request and config read pins a snapshot */
+static void* reader_thread(void *arg) {
+    (void)arg;
+    comm_request_t req = {REQ_IO_READ, 0x1904, 0x0, 4, NULL, 0, 0, 5, NULL, 0};
+    while (!g_stop) {
+        bridge_config_t config;
+        CHECK(bridge_get_config(&config, NULL) == BRIDGE_SUCCESS);
+        CHECK(config.queue_depth == 256);
+        bridge_forward_request(g_device, &req);
+    }
+    return NULL;
+}
+
+/* Helper: write a config file */
+static void write_config(const char *path, uint32_t batch_timeout_ms) {
+    FILE *f = fopen(path, "w");
+    CHECK(f != NULL);
+    fprintf(f, "# test\nbatch_timeout_ms = %u\nmode = %s\n", batch_timeout_ms,
+            batch_timeout_ms % 2 ? "learning" : "passthrough");
+    CHECK(fclose(f) == 0);
+}
+
+int main(void) {
+    bridge_config_t config = { .min_workers = 1, .max_workers = 2, .queue_depth = 256,
+                               .sync_timeout_us = TEST_SYNC_TIMEOUT_US };
+    CHECK(bridge_init(&config) == BRIDGE_SUCCESS);
+    g_device = bridge_register_device(0x1904, CHIPSET_INTEL, NULL, NULL);
+    CHECK(g_device != NULL);
+    
+    char path[] = "/tmp/bridge_conf_XXXXXX";
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    close(fd);
+    
+    pthread_t readers[TEST_READERS];
+    for (int i = 0; i < TEST_READERS; i++) {
+        CHECK(pthread_create(&readers[i], NULL, reader_thread, NULL) == 0);
+    }
+    
+    for (uint32_t i = 0; i < TEST_RELOADS; i++) {
+        write_config(path, 5 + i % 10);
+        CHECK(bridge_reload_config(path) == BRIDGE_SUCCESS);
+    }
+    
+    /* Replaced snapshots are freed while readers keep running */
+    bridge_stats_t stats;
+    bridge_get_stats(&stats);
+    CHECK(stats.config_version == 1 + TEST_RELOADS);
+    CHECK(stats.config_reclaimed > 0);
+    
+    g_stop = true;
+    for (int i = 0; i < TEST_READERS; i++) {
+        pthread_join(readers[i], NULL);
+    }
+    
+    /* With no reader left, everything but the current snapshot goes */
+    uint64_t deadline = test_now_ms() + 1000;
+    do {
+        bridge_get_stats(&stats);
+    } while (stats.config_reclaimed < stats.config_version - 1 && test_now_ms() < deadline);
+    CHECK(stats.config_reclaimed == stats.config_version - 1);
+    
+    /* The last reload is the one in effect */
+    uint64_t version = 0;
+    CHECK(bridge_get_config(&config, &version) == BRIDGE_SUCCESS);
+    CHECK(version == stats.config_version);
+    CHECK(config.batch_timeout_ms == 5 + (TEST_RELOADS - 1) % 10);
+    
+    unlink(path);
+    bridge_unregister_device(g_device);
+    bridge_shutdown();
+    
+    printf("test_config: ok (%lu of %lu snapshots reclaimed)\n",
+           (unsigned long)stats.config_reclaimed, (unsigned long)stats.config_version);
+    return 0;
+}
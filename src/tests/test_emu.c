@@ -0,0 +1,162 @@
+/*
+ * ParrotWinKernel - Chipset Emulator Test
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Chipset Emulator Test
+ * 
+ * Register side effects, DMA through block transfers, interrupts, and
+ * per-function statistics for two functions sharing a device ID.
+ */
+
+#include "test_common.h"
+#include "kernel_bridge/kernel_bridge.h"
+#include "chipset_drivers/chipset_driver.h"
+#include "chipset_drivers/chipset_emu.h"
+
+#define TEST_BLOCK      (64 * 1024)
+
+static uint32_t g_irqs = 0;
+
+static void irq_handler(uint32_t device_id, uint32_t vector, void *user_data) {
+    (void)device_id;
+    (void)user_data;
+    if (vector == 0) {
+        __atomic_add_fetch(&g_irqs, 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+/* Helper: load one function of the emulated root port */
+static void load_port(chipset_driver_t *driver, const char *address) {
+    memset(driver, 0, sizeof(*driver));
+    snprintf(driver->name, sizeof(driver->name), "root port %s", address);
+    snprintf(driver->pci_address, sizeof(driver->pci_address), "%s", address);
+    driver->vendor_id = 0x8086;
+    driver->device_id = 0x9D14;
+    driver->chipset_type = CHIPSET_INTEL;
+    CHECK(chipset_load_driver(driver) == CHIPSET_SUCCESS);
+}
+
+int main(void) {
+    static uint8_t out[TEST_BLOCK], in[TEST_BLOCK];
+    
+    bridge_config_t config = { .min_workers = 1, .max_workers = 2,
+                               .sync_timeout_us = TEST_SYNC_TIMEOUT_US };
+    CHECK(bridge_init(&config) == BRIDGE_SUCCESS);
+    CHECK(chipset_init() == CHIPSET_SUCCESS);
+    chipset_emu_config_t emu = { .irq_handler = irq_handler };
+    CHECK(chipset_emu_enable(&emu) == CHIPSET_SUCCESS);
+    
+    /* Two functions sharing a device ID each get their own model */
+    chipset_driver_t a, b;
+    load_port(&a, "0000:00:1c.0");
+    load_port(&b, "0000:00:1c.1");
+    
+    uint32_t value = 0;
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_ID, &value) == CHIPSET_SUCCESS);
+    CHECK(value == (0x9D14u << 16 | 0x8086));
+    CHECK(chipset_write_register(&a, CHIPSET_EMU_REG_SCRATCH, 0xA5A5A5A5) == CHIPSET_SUCCESS);
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_SCRATCH, &value) == CHIPSET_SUCCESS);
+    CHECK(value == 0xA5A5A5A5);
+    CHECK(chipset_read_register(&b, CHIPSET_EMU_REG_SCRATCH, &value) == CHIPSET_SUCCESS);
+    CHECK(value == 0);
+    
+    chipset_emu_stats_t stats_a, stats_b;
+    CHECK(chipset_emu_get_stats(&a, &stats_a) == CHIPSET_SUCCESS);
+    CHECK(chipset_emu_get_stats(&b, &stats_b) == CHIPSET_SUCCESS);
+    CHECK(stats_a.register_writes == 1);
+    CHECK(stats_b.register_writes == 0);
+    CHECK(stats_b.register_reads == 1);
+    
+    /* The counter advances on every read */
+    uint32_t first = 0, second = 0;
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_COUNTER, &first) == CHIPSET_SUCCESS);
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_COUNTER, &second) == CHIPSET_SUCCESS);
+    CHECK(second == first + 1);
+    
+    /* A block goes through the DMA engine and raises DMA_DONE */
+    CHECK(chipset_write_register(&a, CHIPSET_EMU_REG_INT_MASK, CHIPSET_EMU_STS_DMA_DONE) ==
+          CHIPSET_SUCCESS);
+    for (uint32_t i = 0; i < TEST_BLOCK; i++) {
+        out[i] = (uint8_t)(i * 7);
+    }
+    CHECK(chipset_write_block(&a, 0x1000, out, TEST_BLOCK) == CHIPSET_SUCCESS);
+    CHECK(chipset_read_block(&a, 0x1000, in, TEST_BLOCK) == CHIPSET_SUCCESS);
+    CHECK(memcmp(out, in, TEST_BLOCK) == 0);
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_DMA_COUNT, &value) == CHIPSET_SUCCESS);
+    CHECK(value == 2);
+    CHECK(__atomic_load_n(&g_irqs, __ATOMIC_SEQ_CST) == 1);
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_STATUS, &value) == CHIPSET_SUCCESS);
+    CHECK(value & CHIPSET_EMU_STS_DMA_DONE);
+    
+    /* Status is write-1-to-clear */
+    CHECK(chipset_write_register(&a, CHIPSET_EMU_REG_STATUS, CHIPSET_EMU_STS_DMA_DONE) ==
+          CHIPSET_SUCCESS);
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_STATUS, &value) == CHIPSET_SUCCESS);
+    CHECK(!(value & CHIPSET_EMU_STS_DMA_DONE));
+    
+    /* Reset restores reset values and reports completion in STATUS */
+    CHECK(chipset_write_register(&a, CHIPSET_EMU_REG_CONTROL, CHIPSET_EMU_CTRL_RESET) ==
+          CHIPSET_SUCCESS);
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_SCRATCH, &value) == CHIPSET_SUCCESS);
+    CHECK(value == 0);
+    CHECK(chipset_read_register(&a, CHIPSET_EMU_REG_STATUS, &value) == CHIPSET_SUCCESS);
+    CHECK(value == CHIPSET_EMU_STS_RESET_DONE);
+    
+    CHECK(chipset_emu_get_stats(&a, &stats_a) == CHIPSET_SUCCESS);
+    CHECK(stats_a.dma_transfers == 2);
+    CHECK(stats_a.dma_bytes == 2 * TEST_BLOCK);
+    CHECK(stats_a.resets == 1);
+    
+    /* Unloaded drivers have no model */
+    chipset_unload_driver(&b);
+    CHECK(chipset_emu_get_stats(&b, &stats_b) == CHIPSET_ERR_NOT_FOUND);
+    chipset_unload_driver(&a);
+    
+    chipset_emu_disable();
+    chipset_shutdown();
+    bridge_shutdown();
+    
+    printf("test_emu: ok\n");
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * ParrotWinKernel - Runtime Power Management Test
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Runtime Power Management Test
+ * 
+ * An idle device autosuspends, the next request resumes it without
+ * failing, and disabling runtime PM leaves it in D0.
+ */
+
+#include <unistd.h>
+#include "test_common.h"
+#include "kernel_bridge/kernel_bridge.h"
+#include "chipset_drivers/chipset_driver.h"
+#include "chipset_drivers/chipset_emu.h"
+
+/* Helper: wait up to a second for the device to reach a D-state */
+static bool wait_for_state(chipset_driver_t *driver, uint32_t state, chipset_pm_stats_t *stats) {
+    uint64_t deadline = test_now_ms() + 1000;
+    do {
+        CHECK(chipset_get_pm_stats(driver, stats) == CHIPSET_SUCCESS);
+        if (stats->power_state == state) {
+            return true;
+        }
+        usleep(1000);
+    } while (test_now_ms() < deadline);
+    return false;
+}
+
+int main(void) {
+    bridge_config_t config = { .min_workers = 1, .max_workers = 2,
+                               .sync_timeout_us = TEST_SYNC_TIMEOUT_US };
+    CHECK(bridge_init(&config) == BRIDGE_SUCCESS);
+    CHECK(chipset_init() == CHIPSET_SUCCESS);
+    CHECK(chipset_emu_enable(NULL) == CHIPSET_SUCCESS);
+    
+    chipset_driver_t driver;
+    memset(&driver, 0, sizeof(driver));
+    snprintf(driver.name, sizeof(driver.name), "test device");
+    driver.vendor_id = 0x8086;
+    driver.device_id = 0x1904;
+    driver.chipset_type = CHIPSET_INTEL;
+    CHECK(chipset_load_driver(&driver) == CHIPSET_SUCCESS);
+    
+    chipset_runtime_pm_t pm = { .autosuspend_delay_ms = 10, .suspend_state = 3 };
+    CHECK(chipset_runtime_pm_enable(&driver, &pm) == CHIPSET_SUCCESS);
+    
+    /* Idle past the delay: suspended */
+    chipset_pm_stats_t stats;
+    CHECK(wait_for_state(&driver, 3, &stats));
+    CHECK(stats.runtime_enabled);
+    CHECK(stats.suspends >= 1);
+    
+    /* A request resumes the device and is held, not failed */
+    uint64_t resumes = stats.resumes;
+    uint32_t value = 0;
+    CHECK(chipset_read_register(&driver, CHIPSET_EMU_REG_SCRATCH, &value) == CHIPSET_SUCCESS);
+    CHECK(chipset_get_pm_stats(&driver, &stats) == CHIPSET_SUCCESS);
+    CHECK(stats.resumes == resumes + 1);
+    
+    /* And it suspends again once idle */
+    CHECK(wait_for_state(&driver, 3, &stats));
+    
+    /* Turning runtime PM off brings the device back to stay */
+    CHECK(chipset_runtime_pm_disable(&driver) == CHIPSET_SUCCESS);
+    CHECK(chipset_get_pm_stats(&driver, &stats) == CHIPSET_SUCCESS);
+    CHECK(stats.power_state == 0);
+    CHECK(!stats.runtime_enabled);
+    
+    chipset_unload_driver(&driver);
+    chipset_shutdown();
+    bridge_shutdown();
+    
+    printf("test_power: ok\n");
+    return 0;
+}
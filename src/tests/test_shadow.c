@@ -0,0 +1,152 @@
+/*
+ * ParrotWinKernel - Shadow Register Cache Test
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Shadow Register Cache Test
+ * 
+ * Write-back registers reach the device only when flushed, coalesced,
+ * and unloading a driver flushes what is still dirty.
+ */
+
+#include "test_common.h"
+#include "kernel_bridge/kernel_bridge.h"
+#include "chipset_drivers/chipset_driver.h"
+
+#define TEST_REGS   64
+
+/* Backend that records what reaches the device */
+static struct {
+    uint32_t regs[TEST_REGS];
+    uint32_t writes;            /* Write requests */
+} g_device;
+
+static void* device_attach(device_context_t *ctx) {
+    (void)ctx;
+    return &g_device;
+}
+
+static void device_detach(device_context_t *ctx, void *state) {
+    (void)ctx;
+    (void)state;
+}
+
+static int device_execute(device_context_t *ctx, void *state, const comm_request_t *req,
+                          uint64_t *value) {
+    (void)ctx;
+    (void)state;
+    uint32_t first = (uint32_t)(req->address / 4) % TEST_REGS;
+    
+    if (req->type == REQ_IO_WRITE && req->data) {
+        /* Coalesced flushes write several adjacent registers at once */
+        for (uint32_t i = 0; i < req->size / 4 && first + i < TEST_REGS; i++) {
+            memcpy(&g_device.regs[first + i], req->data + i * 4, 4);
+        }
+        __atomic_add_fetch(&g_device.writes, 1, __ATOMIC_SEQ_CST);
+    } else if (req->type == REQ_IO_READ) {
+        *value = g_device.regs[first];
+        if (req->data && req->size == 4) {
+            memcpy(req->data, &g_device.regs[first], 4);
+        }
+    }
+    return BRIDGE_SUCCESS;
+}
+
+static const bridge_backend_t device_backend = {
+    .name = "test",
+    .attach = device_attach,
+    .detach = device_detach,
+    .execute = device_execute
+};
+
+int main(void) {
+    bridge_config_t config = { .min_workers = 1, .max_workers = 2,
+                               .sync_timeout_us = TEST_SYNC_TIMEOUT_US };
+    CHECK(bridge_init(&config) == BRIDGE_SUCCESS);
+    CHECK(bridge_set_backend(&device_backend) == BRIDGE_SUCCESS);
+    CHECK(chipset_init() == CHIPSET_SUCCESS);
+    
+    chipset_driver_t driver;
+    memset(&driver, 0, sizeof(driver));
+    snprintf(driver.name, sizeof(driver.name), "test device");
+    driver.vendor_id = 0x8086;
+    driver.device_id = 0x1904;
+    driver.chipset_type = CHIPSET_INTEL;
+    CHECK(chipset_load_driver(&driver) == CHIPSET_SUCCESS);
+    CHECK(chipset_shadow_set_policy(&driver, 0x10, 0x10, CHIPSET_CACHE_WRITE_BACK) ==
+          CHIPSET_SUCCESS);
+    
+    /* Write-back writes stay in the shadow until flushed */
+    CHECK(chipset_write_register(&driver, 0x10, 0x11111111) == CHIPSET_SUCCESS);
+    CHECK(chipset_write_register(&driver, 0x14, 0x22222222) == CHIPSET_SUCCESS);
+    uint32_t value = 0;
+    CHECK(chipset_read_register(&driver, 0x10, &value) == CHIPSET_SUCCESS);
+    CHECK(value == 0x11111111);
+    CHECK(__atomic_load_n(&g_device.writes, __ATOMIC_SEQ_CST) == 0);
+    
+    /* Adjacent dirty registers go out as one write */
+    CHECK(chipset_shadow_flush(&driver) == CHIPSET_SUCCESS);
+    CHECK(__atomic_load_n(&g_device.writes, __ATOMIC_SEQ_CST) == 1);
+    CHECK(g_device.regs[0x10 / 4] == 0x11111111);
+    CHECK(g_device.regs[0x14 / 4] == 0x22222222);
+    
+    chipset_shadow_stats_t stats;
+    CHECK(chipset_shadow_get_stats(&driver, &stats) == CHIPSET_SUCCESS);
+    CHECK(stats.absorbed_writes == 2);
+    CHECK(stats.flushed_registers == 2);
+    
+    /* Unload writes back what is still dirty, through a stale copy too */
+    CHECK(chipset_write_register(&driver, 0x1C, 0x33333333) == CHIPSET_SUCCESS);
+    CHECK(g_device.regs[0x1C / 4] == 0);
+    chipset_driver_t copy = driver;
+    chipset_unload_driver(&copy);
+    CHECK(g_device.regs[0x1C / 4] == 0x33333333);
+    CHECK(!copy.loaded);
+    CHECK(chipset_read_register(&driver, 0x10, &value) != CHIPSET_SUCCESS);
+    
+    chipset_shutdown();
+    bridge_shutdown();
+    
+    printf("test_shadow: ok\n");
+    return 0;
+}
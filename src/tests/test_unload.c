@@ -0,0 +1,141 @@
+/*
+ * ParrotWinKernel - Driver Unload Test
+ * 
+ * Copyright (c) 2026 James H Roop. All Rights Reserved.
+ * 
+ * EXPRESSION OF CREATIVE WORK:
+ * This work embodies the Expression of James H Roop's original plan and theory 
+ * of implementation. The creative intellectual property includes the IMPLEMENTATION, 
+ * ARCHITECTURE, DESIGN, and SOLUTION as the creative Expression of the plan and 
+ * theoretical framework.
+ * 
+ * NO PROPRIETARY INFORMATION USED: This work contains NO proprietary information 
+ * from Microsoft, Linux, Debian, Parrot, or any other entities. Everything is 
+ * SIMULATED based on publicly available specifications and original creative 
+ * expression. Future development will proceed without proprietary information.
+ * 
+ * While individual code segments may reference publicly available specifications
+ * or reverse-engineered interfaces, the creative expression, methodology,
+ * and integrated solution are entirely original and protected works.
+ * 
+ * This creative property includes but is not limited to:
+ * - The AI-assisted communication buffer architecture
+ * - The integration methodology between Windows and Linux kernels
+ * - The specific implementation of the hybrid driver system
+ * - The novel approach to cross-kernel driver compatibility
+ * - The design patterns and architectural decisions
+ * - The unique combination and integration of technologies
+ * 
+ * NO OWNERSHIP CLAIM is made over:
+ * - Public specifications (Windows API, Linux kernel interfaces)
+ * - Standard algorithms or publicly known techniques
+ * - Third-party code or libraries used
+ * 
+ * This file is part of ParrotWinKernel, a Windows driver compatibility
+ * layer for Linux with AI-assisted communication buffering.
+ * 
+ * Permission to use, copy, modify, and distribute this software is
+ * granted under the terms specified in the LICENSE file in the root
+ * directory of this project.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND.
+ * See LICENSE file for full terms and conditions.
+ * 
+ * ---
+ * 
+ * Driver Unload Test
+ * 
+ * Readers look a driver up and use their copy while another thread
+ * loads and unloads it. Every call either runs against a loaded driver
+ * or fails with CHIPSET_ERR_NOT_FOUND; none reaches a torn-down one
+ * (build with -fsanitize=address to catch that directly).
+ */
+
+#include <pthread.h>
+#include "test_common.h"
+#include "kernel_bridge/kernel_bridge.h"
+#include "chipset_drivers/chipset_driver.h"
+#include "chipset_drivers/chipset_emu.h"
+
+#define TEST_READERS    4
+#define TEST_CYCLES     100
+
+static volatile bool g_stop = false;
+static uint64_t g_reads = 0;        /* Reads that reached a loaded driver */
+static uint64_t g_misses = 0;       /* Calls refused as not loaded */
+static uint64_t g_errors = 0;       /* Any other result */
+
+/* Reader: look the driver up and use the copy, racing the unloads */
+static void* reader_thread(void *arg) {
+    (void)arg;
+    while (!g_stop) {
+        chipset_driver_t copy;
+        if (chipset_find_driver(0x8086, 0x1904, "", &copy) != CHIPSET_SUCCESS) {
+            continue;
+        }
+        
+        uint32_t value;
+        int ret = chipset_read_register(&copy, CHIPSET_EMU_REG_SCRATCH, &value);
+        driver_capabilities_t caps;
+        int caps_ret = chipset_get_capabilities(&copy, &caps);
+        if (ret == CHIPSET_SUCCESS) {
+            __atomic_add_fetch(&g_reads, 1, __ATOMIC_RELAXED);
+        } else if (ret == CHIPSET_ERR_NOT_FOUND) {
+            __atomic_add_fetch(&g_misses, 1, __ATOMIC_RELAXED);
+        } else {
+            __atomic_add_fetch(&g_errors, 1, __ATOMIC_RELAXED);
+        }
+        if (caps_ret != CHIPSET_SUCCESS && caps_ret != CHIPSET_ERR_NOT_FOUND) {
+            __atomic_add_fetch(&g_errors, 1, __ATOMIC_RELAXED);
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    bridge_config_t config = { .min_workers = 1, .max_workers = 4,
+                               .sync_timeout_us = TEST_SYNC_TIMEOUT_US };
+    CHECK(bridge_init(&config) == BRIDGE_SUCCESS);
+    CHECK(chipset_init() == CHIPSET_SUCCESS);
+    CHECK(chipset_emu_enable(NULL) == CHIPSET_SUCCESS);
+    
+    pthread_t readers[TEST_READERS];
+    for (int i = 0; i < TEST_READERS; i++) {
+        CHECK(pthread_create(&readers[i], NULL, reader_thread, NULL) == 0);
+    }
+    
+    for (int cycle = 0; cycle < TEST_CYCLES; cycle++) {
+        chipset_driver_t driver;
+        memset(&driver, 0, sizeof(driver));
+        snprintf(driver.name, sizeof(driver.name), "test device");
+        driver.vendor_id = 0x8086;
+        driver.device_id = 0x1904;
+        driver.chipset_type = CHIPSET_INTEL;
+        CHECK(chipset_load_driver(&driver) == CHIPSET_SUCCESS);
+        
+        /* Unload while readers are using it */
+        uint64_t reads = __atomic_load_n(&g_reads, __ATOMIC_RELAXED);
+        uint64_t deadline = test_now_ms() + 1000;
+        while (__atomic_load_n(&g_reads, __ATOMIC_RELAXED) == reads && test_now_ms() < deadline) {
+            /* Wait for a read to land */
+        }
+        chipset_unload_driver(&driver);
+        CHECK(!driver.loaded);
+    }
+    
+    g_stop = true;
+    for (int i = 0; i < TEST_READERS; i++) {
+        pthread_join(readers[i], NULL);
+    }
+    
+    CHECK(g_errors == 0);
+    CHECK(g_reads >= TEST_CYCLES);
+    CHECK(chipset_loaded_count() == 0);
+    
+    chipset_shutdown();
+    bridge_shutdown();
+    
+    printf("test_unload: ok (%lu reads, %lu refused)\n",
+           (unsigned long)g_reads, (unsigned long)g_misses);
+    return 0;
+}